@@ -25,10 +25,18 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cstdint>
 #include <random>
 
 #include "Actions.h"
 #include "Dice.h"
+#include "Pcg32.h"
+#include "Pcg64.h"
+#include "Philox4x32.h"
+#include "PreparedDice.h"
+#include "SplitMix64.h"
+#include "WyRand.h"
+#include "Xoshiro256StarStar.h"
 
 // measure the cost Roll a Dice object with mt19937
 static void BM_Roll_w_mt19937(benchmark::State& state) {
@@ -120,3 +128,283 @@ static void BM_Roll_w_minstd_rand(benchmark::State& state) {
 }
 // register this benchmark
 BENCHMARK(BM_Roll_w_minstd_rand);
+
+// measure the cost Roll a Dice object with Xoshiro256StarStar Engine
+static void BM_Roll_w_xoshiro256starstar(benchmark::State& state) {
+  const auto dice = game_dice_cpp::Dice(20);
+  auto engine = game_dice_cpp::Xoshiro256StarStar(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_w_xoshiro256starstar);
+
+// measure the cost Roll a Dice object with Pcg32 Engine
+static void BM_Roll_w_pcg32(benchmark::State& state) {
+  const auto dice = game_dice_cpp::Dice(20);
+  auto engine = game_dice_cpp::Pcg32(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_w_pcg32);
+
+// measure the cost Roll a Dice object with Pcg64 Engine
+static void BM_Roll_w_pcg64(benchmark::State& state) {
+  const auto dice = game_dice_cpp::Dice(20);
+  auto engine = game_dice_cpp::Pcg64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_w_pcg64);
+
+// measure the cost Roll a Dice object with SplitMix64 Engine
+static void BM_Roll_w_splitmix64(benchmark::State& state) {
+  const auto dice = game_dice_cpp::Dice(20);
+  auto engine = game_dice_cpp::SplitMix64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_w_splitmix64);
+
+// measure the cost Roll a Dice object with WyRand Engine
+static void BM_Roll_w_wyrand(benchmark::State& state) {
+  const auto dice = game_dice_cpp::Dice(20);
+  auto engine = game_dice_cpp::WyRand(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_w_wyrand);
+
+// measure the cost Roll a Dice object with Philox4x32 Engine
+static void BM_Roll_w_philox4x32(benchmark::State& state) {
+  const auto dice = game_dice_cpp::Dice(20);
+  auto engine = game_dice_cpp::Philox4x32(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_w_philox4x32);
+
+// measure the cost Roll a 64-bit Dice object with mt19937_64 Engine
+static void BM_Roll_Uint64_w_mt19937_64(benchmark::State& state) {
+  const auto dice = game_dice_cpp::BasicDice<std::uint64_t>(10'000'000'000);
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Uint64_w_mt19937_64);
+
+// measure the cost Roll a PreparedDice object with mt19937 Engine
+static void BM_Roll_Prepared_w_mt19937(benchmark::State& state) {
+  const auto dice = game_dice_cpp::PreparedDice(game_dice_cpp::Dice(20));
+  auto engine = std::mt19937(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Prepared_w_mt19937);
+
+// measure the cost Roll a PreparedDice object with mt19937_64 Engine
+static void BM_Roll_Prepared_w_mt19937_64(benchmark::State& state) {
+  const auto dice = game_dice_cpp::PreparedDice(game_dice_cpp::Dice(20));
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Prepared_w_mt19937_64);
+
+// measure the cost Roll a PreparedDice object with ranlux24_base Engine
+static void BM_Roll_Prepared_w_ranlux24_base(benchmark::State& state) {
+  const auto dice = game_dice_cpp::PreparedDice(game_dice_cpp::Dice(20));
+  auto engine = std::ranlux24_base(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Prepared_w_ranlux24_base);
+
+// measure the cost Roll a PreparedDice object with ranlux48_base Engine
+static void BM_Roll_Prepared_w_ranlux48_base(benchmark::State& state) {
+  const auto dice = game_dice_cpp::PreparedDice(game_dice_cpp::Dice(20));
+  auto engine = std::ranlux48_base(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Prepared_w_ranlux48_base);
+
+// measure the cost Roll a PreparedDice object with ranlux24 Engine
+static void BM_Roll_Prepared_w_ranlux24(benchmark::State& state) {
+  const auto dice = game_dice_cpp::PreparedDice(game_dice_cpp::Dice(20));
+  auto engine = std::ranlux24(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Prepared_w_ranlux24);
+
+// measure the cost Roll a PreparedDice object with ranlux48 Engine
+static void BM_Roll_Prepared_w_ranlux48(benchmark::State& state) {
+  const auto dice = game_dice_cpp::PreparedDice(game_dice_cpp::Dice(20));
+  auto engine = std::ranlux48(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Prepared_w_ranlux48);
+
+// measure the cost Roll a PreparedDice object with minstd_rand Engine
+static void BM_Roll_Prepared_w_minstd_rand(benchmark::State& state) {
+  const auto dice = game_dice_cpp::PreparedDice(game_dice_cpp::Dice(20));
+  auto engine = std::minstd_rand(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::Roll(dice, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Roll_Prepared_w_minstd_rand);
+
+// measure the cost of std::uniform_int_distribution, which Roll used to draw
+// with, on a d20 with mt19937 Engine
+static void BM_UniformIntDistribution_w_mt19937(benchmark::State& state) {
+  auto engine = std::mt19937(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::uniform_int_distribution<int> distribution(1, 20);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_UniformIntDistribution_w_mt19937);
+
+// measure the cost of std::uniform_int_distribution, which Roll used to draw
+// with, on a d20 with mt19937_64 Engine
+static void BM_UniformIntDistribution_w_mt19937_64(benchmark::State& state) {
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::uniform_int_distribution<int> distribution(1, 20);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_UniformIntDistribution_w_mt19937_64);
+
+// measure the cost of std::uniform_int_distribution, which Roll used to draw
+// with, on a d20 with ranlux24_base Engine
+static void BM_UniformIntDistribution_w_ranlux24_base(benchmark::State& state) {
+  auto engine = std::ranlux24_base(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::uniform_int_distribution<int> distribution(1, 20);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_UniformIntDistribution_w_ranlux24_base);
+
+// measure the cost of std::uniform_int_distribution, which Roll used to draw
+// with, on a d20 with ranlux48_base Engine
+static void BM_UniformIntDistribution_w_ranlux48_base(benchmark::State& state) {
+  auto engine = std::ranlux48_base(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::uniform_int_distribution<int> distribution(1, 20);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_UniformIntDistribution_w_ranlux48_base);
+
+// measure the cost of std::uniform_int_distribution, which Roll used to draw
+// with, on a d20 with ranlux24 Engine
+static void BM_UniformIntDistribution_w_ranlux24(benchmark::State& state) {
+  auto engine = std::ranlux24(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::uniform_int_distribution<int> distribution(1, 20);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_UniformIntDistribution_w_ranlux24);
+
+// measure the cost of std::uniform_int_distribution, which Roll used to draw
+// with, on a d20 with ranlux48 Engine
+static void BM_UniformIntDistribution_w_ranlux48(benchmark::State& state) {
+  auto engine = std::ranlux48(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::uniform_int_distribution<int> distribution(1, 20);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_UniformIntDistribution_w_ranlux48);
+
+// measure the cost of std::uniform_int_distribution, which Roll used to draw
+// with, on a d20 with minstd_rand Engine
+static void BM_UniformIntDistribution_w_minstd_rand(benchmark::State& state) {
+  auto engine = std::minstd_rand(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::uniform_int_distribution<int> distribution(1, 20);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_UniformIntDistribution_w_minstd_rand);
@@ -0,0 +1,108 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "CompactProbabilityTable.h"
+#include "DynamicProbabilityTable.h"
+
+// measure the cost of lookup in CompactProbabilityTable with random rolls and
+// report the memory used by one table
+static void BM_CompactProbabilityTable_GetOutcomeIndex(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 200) + 1;
+  }
+  const auto encoding =
+      static_cast<game_dice_cpp::ThresholdEncoding>(state.range(1));
+  auto table_opt = game_dice_cpp::CompactProbabilityTable::Make(weights, encoding);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+  state.counters["bytes_per_table"] =
+      static_cast<double>(table.GetMemoryUsage());
+}
+// register this benchmark (encodings: 1 = narrow, 2 = delta blocks)
+BENCHMARK(BM_CompactProbabilityTable_GetOutcomeIndex)
+    ->ArgsProduct({{8, 64, 512, 2048}, {1, 2}});
+
+// measure the cost of lookup in DynamicProbabilityTable with the same weights
+// and report the memory used by one table
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Baseline(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 200) + 1;
+  }
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(
+      weights, {.dense_lookup_max_weight = 0});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+  state.counters["bytes_per_table"] = static_cast<double>(
+      sizeof(table) + (weights.size() * sizeof(int)));
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Baseline)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(512)
+    ->Arg(2048);
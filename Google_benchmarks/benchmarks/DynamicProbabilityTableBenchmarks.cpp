@@ -25,9 +25,18 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
 #include <random>
+#include <ranges>
+#include <span>
 #include <vector>
 
+#include "Actions.h"
+#include "Dice.h"
+#include "DynamicAliasTable.h"
 #include "DynamicProbabilityTable.h"
 
 // measure the cost of making a DynamicProbabilityTable object
@@ -41,7 +50,69 @@ static void BM_DynamicProbabilityTable_Make(benchmark::State& state) {
   }
 }
 // register this benchmark
-BENCHMARK(BM_DynamicProbabilityTable_Make)->RangeMultiplier(2)->Range(8, 2048);
+BENCHMARK(BM_DynamicProbabilityTable_Make)
+    ->RangeMultiplier(2)
+    ->Range(8, 1 << 16);
+
+// measure the cost of making a very large DynamicProbabilityTable on 1 to N
+// threads (arguments: outcomes, threads)
+static void BM_DynamicProbabilityTable_Make_Parallel(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 7);
+  }
+  const auto threads = static_cast<std::size_t>(state.range(1));
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::DynamicProbabilityTable::Make(
+        std::span<const int>(weights), {.build_threads = threads}));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Make_Parallel)
+    ->ArgsProduct({{1 << 20, 1 << 23, 1 << 26}, {1, 2, 4, 8}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// measure the cost of making a DynamicProbabilityTable straight from a
+// generated (non-contiguous) range of weights
+static void BM_DynamicProbabilityTable_Make_Range(benchmark::State& state) {
+  const auto weights =
+      std::views::iota(0, static_cast<int>(state.range(0))) |
+      std::views::transform([](int i) { return (i % 200) + 1; });
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        game_dice_cpp::DynamicProbabilityTable::Make(weights));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Make_Range)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 18);
+
+// measure the cost of collecting the same range into a vector and making a
+// DynamicProbabilityTable from it (the only option before ranges were accepted)
+static void BM_DynamicProbabilityTable_Make_CollectThenMake(
+    benchmark::State& state) {
+  const auto weights =
+      std::views::iota(0, static_cast<int>(state.range(0))) |
+      std::views::transform([](int i) { return (i % 200) + 1; });
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    const std::vector<int> collected(weights.begin(), weights.end());
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::DynamicProbabilityTable::Make(
+        std::span<const int>(collected)));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Make_CollectThenMake)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 18);
 
 // measure the cost of GetTotalWeight in DynamicProbabilityTable
 static void BM_DynamicProbabilityTable_GetTotalWeight(benchmark::State& state) {
@@ -92,3 +163,465 @@ static void BM_DynamicProbabilityTable_GetOutcomeIndex(
 BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex)
     ->RangeMultiplier(2)
     ->Range(8, 2048);
+
+// measure the cost of looking up a batch of rolls one at a time in
+// DynamicProbabilityTable
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Batch(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(static_cast<std::size_t>(state.range(1)));
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::vector<int> outputs(inputs.size());
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      outputs[i] = table.GetOutcomeIndex(inputs[i]);
+    }
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(outputs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          state.range(1));
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Batch)
+    ->ArgsProduct({{2048, 1 << 20}, {16, 64, 256, 1024, 4096}});
+
+// measure the cost of looking up a batch of rolls with GetOutcomeIndexes in
+// DynamicProbabilityTable
+static void BM_DynamicProbabilityTable_GetOutcomeIndexes(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(static_cast<std::size_t>(state.range(1)));
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::vector<int> outputs(inputs.size());
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    table.GetOutcomeIndexes(inputs, outputs);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(outputs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          state.range(1));
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndexes)
+    ->ArgsProduct({{2048, 1 << 20}, {16, 64, 256, 1024, 4096}});
+
+// measure the cost of lookup in DynamicProbabilityTable with random rolls on
+// tables that outgrow the caches
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Random(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Random)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 22);
+
+// measure the cost of creating a DynamicProbabilityTable with a guide table
+static void BM_DynamicProbabilityTable_Make_Guide(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::DynamicProbabilityTable::Make(
+        weights, {.guide_table_size = weights.size()}));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Make_Guide)
+    ->RangeMultiplier(2)
+    ->Range(8, 2048);
+
+namespace {
+// A memory resource that counts the allocations passed to the heap.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::int64_t allocations{0};
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* pointer, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+  [[nodiscard]] bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+// measure the cost of steady-state rebuilds of one DynamicProbabilityTable,
+// alternating between two sets of weights, and report the allocations made
+static void BM_DynamicProbabilityTable_Rebuild(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  std::vector<int> weights_A(size);
+  std::vector<int> weights_B(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    weights_A[i] = static_cast<int>(i % 200) + 1;
+    weights_B[i] = static_cast<int>((i * 7) % 300) + 1;
+  }
+  CountingResource resource;
+  auto table_opt = game_dice_cpp::pmr::DynamicProbabilityTable::Make(
+      weights_A, {}, &resource);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  auto& table = *table_opt;
+  // rebuild with both sets once so the capacity reaches its steady state
+  if (!table.Rebuild(weights_B) || !table.Rebuild(weights_A)) {
+    state.SkipWithError("Failed to rebuild table.");
+    return;
+  }
+  const std::int64_t allocations_after_warm_up = resource.allocations;
+  bool use_A = false;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.Rebuild(use_A ? weights_A : weights_B));
+    use_A = !use_A;
+  }
+  state.counters["allocations"] =
+      static_cast<double>(resource.allocations - allocations_after_warm_up);
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Rebuild)
+    ->RangeMultiplier(4)
+    ->Range(8, 1 << 14);
+
+// measure the cost of making a fresh table for the same alternating weights
+// (compare with BM_DynamicProbabilityTable_Rebuild)
+static void BM_DynamicProbabilityTable_Rebuild_MakeBaseline(
+    benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  std::vector<int> weights_A(size);
+  std::vector<int> weights_B(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    weights_A[i] = static_cast<int>(i % 200) + 1;
+    weights_B[i] = static_cast<int>((i * 7) % 300) + 1;
+  }
+  CountingResource resource;
+  auto table = game_dice_cpp::pmr::DynamicProbabilityTable::Make(
+      weights_A, {}, &resource);
+  bool use_A = false;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    table = game_dice_cpp::pmr::DynamicProbabilityTable::Make(
+        use_A ? weights_A : weights_B, {}, &resource);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table);
+    use_A = !use_A;
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(resource.allocations),
+      benchmark::Counter::kAvgIterations);
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Rebuild_MakeBaseline)
+    ->RangeMultiplier(4)
+    ->Range(8, 1 << 14);
+
+// measure the cost of making a DynamicProbabilityTable from a per-iteration
+// monotonic arena (compare with BM_DynamicProbabilityTable_Make)
+static void BM_DynamicProbabilityTable_Make_Monotonic(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  // enough space for the thresholds and the dense lookup table
+  std::vector<std::byte> buffer((weights.size() + 1) * 8 + 256);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        game_dice_cpp::pmr::DynamicProbabilityTable::Make(weights, {}, &arena));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Make_Monotonic)
+    ->RangeMultiplier(2)
+    ->Range(8, 2048);
+
+// measure the cost of making a DynamicProbabilityTable from a pool that is
+// shared by every iteration (compare with BM_DynamicProbabilityTable_Make)
+static void BM_DynamicProbabilityTable_Make_Pool(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  std::pmr::unsynchronized_pool_resource pool;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        game_dice_cpp::pmr::DynamicProbabilityTable::Make(weights, {}, &pool));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Make_Pool)
+    ->RangeMultiplier(2)
+    ->Range(8, 2048);
+
+// measure the cost of lookup in a DynamicProbabilityTable with 64-bit weights
+// and random rolls (compare with _Random for 32-bit weights)
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Random_Uint64(
+    benchmark::State& state) {
+  std::vector<std::uint64_t> weights(static_cast<std::size_t>(state.range(0)),
+                                     1);
+  auto table_opt =
+      game_dice_cpp::BasicDynamicProbabilityTable<std::uint64_t>::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937_64(42);
+  std::uniform_int_distribution<std::uint64_t> distribution(
+      1, table.GetTotalWeight());
+  std::vector<std::uint64_t> inputs(4096);
+  for (std::uint64_t& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Random_Uint64)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 22);
+
+// measure the cost of lookup in DynamicProbabilityTable with a guide table and
+// random rolls on tables that do not fit in cache
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Random_Guide(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 7) + 1;
+  }
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(
+      weights, {.guide_table_size = weights.size()});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Random_Guide)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 22);
+
+// measure the cost of lookup in DynamicProbabilityTable with a dense lookup as
+// the total weight grows (compare with _Search to find the crossover)
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Dense(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)) / 4, 4);
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(
+      weights, {.dense_lookup_max_weight = game_dice_cpp::
+                    DynamicProbabilityTableOptions::dense_lookup_weight_limit});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Dense)
+    ->RangeMultiplier(4)
+    ->Range(16, 1 << 20);
+
+// measure the cost of lookup in DynamicProbabilityTable with a search as the
+// total weight grows (compare with _Dense to find the crossover)
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Search(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)) / 4, 4);
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(
+      weights, {.dense_lookup_max_weight = 0});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Search)
+    ->RangeMultiplier(4)
+    ->Range(16, 1 << 20);
+
+// measure the cost of sampling a DynamicProbabilityTable with a Dice roll
+static void BM_DynamicProbabilityTable_Sample(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 7) + 1;
+  }
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  const auto dice = game_dice_cpp::Dice(table.GetTotalWeight());
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        table.GetOutcomeIndex(game_dice_cpp::Roll(dice, engine)));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Sample)->RangeMultiplier(2)->Range(8, 2048);
+
+// measure the cost of making a DynamicAliasTable object
+static void BM_DynamicAliasTable_Make(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::DynamicAliasTable::Make(weights));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicAliasTable_Make)->RangeMultiplier(2)->Range(8, 2048);
+
+// measure the cost of lookup in DynamicAliasTable
+static void BM_DynamicAliasTable_GetOutcomeIndex(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  auto table_opt = game_dice_cpp::DynamicAliasTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  const std::uint64_t roll_range = table.GetRollRange();
+  std::uint64_t input = 1;
+  const std::uint64_t stride = 127;  // some prime number stride helps hit
+                                     // different cache lines
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(input));
+    // alternate increment
+    input = input + stride;
+    if (input > roll_range) {
+      input = (input % roll_range) + 1;
+    }
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicAliasTable_GetOutcomeIndex)
+    ->RangeMultiplier(2)
+    ->Range(8, 2048);
+
+// measure the cost of sampling a DynamicAliasTable
+static void BM_DynamicAliasTable_Sample(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 7) + 1;
+  }
+  auto table_opt = game_dice_cpp::DynamicAliasTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.Sample(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicAliasTable_Sample)->RangeMultiplier(2)->Range(8, 2048);
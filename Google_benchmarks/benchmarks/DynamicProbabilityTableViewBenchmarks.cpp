@@ -0,0 +1,146 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "DynamicProbabilityTableView.h"
+
+namespace {
+// Builds the cumulative thresholds of count tables of size outcomes each.
+std::vector<int> MakeThresholdBlob(std::size_t count, std::size_t size) {
+  std::vector<int> blob;
+  blob.reserve(count * size);
+  for (std::size_t table = 0; table < count; ++table) {
+    int threshold = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      threshold += static_cast<int>((i + table) % 7) + 1;
+      blob.push_back(threshold);
+    }
+  }
+  return blob;
+}
+}  // namespace
+
+// measure the cost of checking and viewing a thousand tables in one blob
+static void BM_DynamicProbabilityTableView_Make(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<int> blob = MakeThresholdBlob(1000, size);
+  const std::span<const int> thresholds(blob);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    for (std::size_t offset = 0; offset < blob.size(); offset += size) {
+      // prevent compiler from optimizing the result away
+      benchmark::DoNotOptimize(game_dice_cpp::DynamicProbabilityTableView::Make(
+          thresholds.subspan(offset, size)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 1000);
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTableView_Make)->Arg(8)->Arg(64)->Arg(512);
+
+// measure the cost of viewing a thousand tables without checking them
+static void BM_DynamicProbabilityTableView_MakeTrusted(
+    benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<int> blob = MakeThresholdBlob(1000, size);
+  const std::span<const int> thresholds(blob);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    for (std::size_t offset = 0; offset < blob.size(); offset += size) {
+      // prevent compiler from optimizing the result away
+      benchmark::DoNotOptimize(
+          game_dice_cpp::DynamicProbabilityTableView::MakeTrusted(
+              thresholds.subspan(offset, size)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 1000);
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTableView_MakeTrusted)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(512);
+
+// measure the cost of copying the same thousand tables into
+// DynamicProbabilityTable objects (compare with _Make)
+static void BM_DynamicProbabilityTableView_CopyBaseline(
+    benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<int> blob = MakeThresholdBlob(1000, size);
+  // recover the weights, as a table can only be made from weights
+  std::vector<int> weights(blob.size());
+  for (std::size_t i = 0; i < blob.size(); ++i) {
+    weights[i] = (i % size == 0) ? blob[i] : blob[i] - blob[i - 1];
+  }
+  const std::span<const int> all_weights(weights);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    for (std::size_t offset = 0; offset < weights.size(); offset += size) {
+      // prevent compiler from optimizing the result away
+      benchmark::DoNotOptimize(game_dice_cpp::DynamicProbabilityTable::Make(
+          all_weights.subspan(offset, size), {.dense_lookup_max_weight = 0}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 1000);
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTableView_CopyBaseline)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(512);
+
+// measure the cost of lookup through a view with random rolls
+static void BM_DynamicProbabilityTableView_GetOutcomeIndex(
+    benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<int> blob = MakeThresholdBlob(1, size);
+  const auto view =
+      game_dice_cpp::DynamicProbabilityTableView::MakeTrusted(blob);
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, view.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(view.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTableView_GetOutcomeIndex)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(512);
@@ -0,0 +1,141 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Pcg32.h"
+#include "Pcg64.h"
+#include "Philox4x32.h"
+#include "SplitMix64.h"
+#include "WyRand.h"
+#include "Xoshiro256StarStar.h"
+
+// measure the cost of seeding a new engine, which a game pays for every entity
+// that owns a stream
+template <typename Engine>
+static void BM_Engine_Seed(benchmark::State& state) {
+  typename Engine::result_type seed = 42;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    Engine engine(seed++);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(engine);
+  }
+  state.counters["state_bytes"] = static_cast<double>(sizeof(Engine));
+}
+// register this benchmark
+BENCHMARK_TEMPLATE(BM_Engine_Seed, std::mt19937);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, std::mt19937_64);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, std::ranlux48);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, std::minstd_rand);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, game_dice_cpp::SplitMix64);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, game_dice_cpp::WyRand);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, game_dice_cpp::Xoshiro256StarStar);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, game_dice_cpp::Pcg32);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, game_dice_cpp::Pcg64);
+BENCHMARK_TEMPLATE(BM_Engine_Seed, game_dice_cpp::Philox4x32);
+
+// measure the cost of drawing a single raw value from an engine
+template <typename Engine>
+static void BM_Engine_Draw(benchmark::State& state) {
+  Engine engine(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(engine());
+  }
+  state.counters["state_bytes"] = static_cast<double>(sizeof(Engine));
+}
+// register this benchmark
+BENCHMARK_TEMPLATE(BM_Engine_Draw, std::mt19937);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, std::mt19937_64);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, std::ranlux48);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, std::minstd_rand);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, game_dice_cpp::SplitMix64);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, game_dice_cpp::WyRand);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, game_dice_cpp::Xoshiro256StarStar);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, game_dice_cpp::Pcg32);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, game_dice_cpp::Pcg64);
+BENCHMARK_TEMPLATE(BM_Engine_Draw, game_dice_cpp::Philox4x32);
+
+// measure the throughput of filling a buffer one value at a time
+template <typename Engine>
+static void BM_Engine_Fill(benchmark::State& state) {
+  Engine engine(42);
+  std::vector<typename Engine::result_type> values(
+      static_cast<std::size_t>(state.range(0)));
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    for (auto& value : values) {
+      value = engine();
+    }
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// register this benchmark
+BENCHMARK_TEMPLATE(BM_Engine_Fill, std::mt19937)->Range(64, 1 << 14);
+BENCHMARK_TEMPLATE(BM_Engine_Fill, game_dice_cpp::Pcg32)->Range(64, 1 << 14);
+BENCHMARK_TEMPLATE(BM_Engine_Fill, game_dice_cpp::Philox4x32)
+    ->Range(64, 1 << 14);
+
+// measure the throughput of filling a buffer with Philox4x32::GenerateBlock
+static void BM_Philox4x32_GenerateBlock(benchmark::State& state) {
+  game_dice_cpp::Philox4x32 engine(42);
+  std::vector<std::uint32_t> values(static_cast<std::size_t>(state.range(0)));
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    engine.GenerateBlock(values);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// register this benchmark
+BENCHMARK(BM_Philox4x32_GenerateBlock)->Range(64, 1 << 14);
+
+// measure the cost of jumping to a far position and drawing one value, which
+// is how a rollback resumes a stream
+static void BM_Philox4x32_SeekAndDraw(benchmark::State& state) {
+  game_dice_cpp::Philox4x32 engine(42);
+  std::uint64_t position = 1'000'003;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    engine.Seek(position);
+    position += 1'000'003;
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(engine());
+  }
+}
+// register this benchmark
+BENCHMARK(BM_Philox4x32_SeekAndDraw);
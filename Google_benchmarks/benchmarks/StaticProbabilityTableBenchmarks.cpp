@@ -25,8 +25,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cstdint>
+#include <cstdint>
 #include <random>
+#include <vector>
 
+#include "Actions.h"
+#include "Dice.h"
+#include "StaticAliasTable.h"
 #include "StaticProbabilityTable.h"
 
 // measure the cost of making a StaticProbabilityTable object of size 8
@@ -89,6 +95,86 @@ static void BM_StaticProbabilityTable_GetTotalWeight_8(
 // register this benchmark
 BENCHMARK(BM_StaticProbabilityTable_GetTotalWeight_8);
 
+// measure the cost of sampling a StaticProbabilityTable object of size 8 with
+// a Dice roll
+static void BM_StaticProbabilityTable_Sample_8(benchmark::State& state) {
+  auto table_opt =
+      game_dice_cpp::StaticProbabilityTable<8>::Make({8, 7, 8, 3, 2, 1, 9, 4});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  const auto dice = game_dice_cpp::Dice(table.GetTotalWeight());
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        table.GetOutcomeIndex(game_dice_cpp::Roll(dice, engine)));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticProbabilityTable_Sample_8);
+
+// measure the cost of making a StaticAliasTable object of size 8
+static void BM_StaticAliasTable_Make_8(benchmark::State& state) {
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::StaticAliasTable<8>::Make(
+        {8, 7, 8, 3, 2, 1, 9, 4}));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticAliasTable_Make_8);
+
+// measure the cost of lookup for a StaticAliasTable object of size 8
+static void BM_StaticAliasTable_GetOutcomeIndex_8(benchmark::State& state) {
+  auto table_opt =
+      game_dice_cpp::StaticAliasTable<8>::Make({8, 7, 8, 3, 2, 1, 9, 4});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  const std::uint64_t roll_range = table.GetRollRange();
+  std::uint64_t input = 1;
+  const std::uint64_t stride = 127;  // some prime number stride helps hit
+                                     // different columns
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(input));
+    // alternate increment
+    input = input + stride;
+    if (input > roll_range) {
+      input = (input % roll_range) + 1;
+    }
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticAliasTable_GetOutcomeIndex_8);
+
+// measure the cost of sampling a StaticAliasTable object of size 8
+static void BM_StaticAliasTable_Sample_8(benchmark::State& state) {
+  auto table_opt =
+      game_dice_cpp::StaticAliasTable<8>::Make({8, 7, 8, 3, 2, 1, 9, 4});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.Sample(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticAliasTable_Sample_8);
+
 // measure the cost of making a StaticProbabilityTable object of size 16
 static void BM_StaticProbabilityTable_Make_16(benchmark::State& state) {
   // the loop where the code to be timed runs
@@ -129,6 +215,35 @@ static void BM_StaticProbabilityTable_GetOutcomeIndex_16(
 // register this benchmark
 BENCHMARK(BM_StaticProbabilityTable_GetOutcomeIndex_16);
 
+// measure the cost of At for a StaticProbabilityTable object of size 16 with
+// 64-bit weights
+static void BM_StaticProbabilityTable_GetOutcomeIndex_Uint64_16(
+    benchmark::State& state) {
+  auto table_opt = game_dice_cpp::BasicStaticProbabilityTable<std::uint64_t, 16>::Make(
+      {1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 2, 2, 6, 3, 7, 8});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  std::uint64_t total_weight = table.GetTotalWeight();
+  std::uint64_t input = 1;
+  // some prime number stride helps hit different cache lines and tree depths
+  const std::uint64_t stride = 127;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(input));
+    // alternate increment
+    input = input + stride;
+    if (input > total_weight) {
+      input = (input % total_weight) + 1;
+    }
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticProbabilityTable_GetOutcomeIndex_Uint64_16);
+
 // measure the cost of GetTotalWeight for a StaticProbabilityTable object of
 // size 16
 static void BM_StaticProbabilityTable_GetTotalWeight_16(
@@ -149,6 +264,86 @@ static void BM_StaticProbabilityTable_GetTotalWeight_16(
 // register this benchmark
 BENCHMARK(BM_StaticProbabilityTable_GetTotalWeight_16);
 
+// measure the cost of sampling a StaticProbabilityTable object of size 16 with
+// a Dice roll
+static void BM_StaticProbabilityTable_Sample_16(benchmark::State& state) {
+  auto table_opt = game_dice_cpp::StaticProbabilityTable<16>::Make(
+      {1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 2, 2, 6, 3, 7, 8});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  const auto dice = game_dice_cpp::Dice(table.GetTotalWeight());
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        table.GetOutcomeIndex(game_dice_cpp::Roll(dice, engine)));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticProbabilityTable_Sample_16);
+
+// measure the cost of making a StaticAliasTable object of size 16
+static void BM_StaticAliasTable_Make_16(benchmark::State& state) {
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(game_dice_cpp::StaticAliasTable<16>::Make(
+        {1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 2, 2, 6, 3, 7, 8}));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticAliasTable_Make_16);
+
+// measure the cost of lookup for a StaticAliasTable object of size 16
+static void BM_StaticAliasTable_GetOutcomeIndex_16(benchmark::State& state) {
+  auto table_opt = game_dice_cpp::StaticAliasTable<16>::Make(
+      {1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 2, 2, 6, 3, 7, 8});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  const std::uint64_t roll_range = table.GetRollRange();
+  std::uint64_t input = 1;
+  const std::uint64_t stride = 127;  // some prime number stride helps hit
+                                     // different columns
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(input));
+    // alternate increment
+    input = input + stride;
+    if (input > roll_range) {
+      input = (input % roll_range) + 1;
+    }
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticAliasTable_GetOutcomeIndex_16);
+
+// measure the cost of sampling a StaticAliasTable object of size 16
+static void BM_StaticAliasTable_Sample_16(benchmark::State& state) {
+  auto table_opt = game_dice_cpp::StaticAliasTable<16>::Make(
+      {1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 2, 2, 6, 3, 7, 8});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.Sample(engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticAliasTable_Sample_16);
+
 // measure the cost of making a StaticProbabilityTable object of size 32
 static void BM_StaticProbabilityTable_Make_32(benchmark::State& state) {
   // the loop where the code to be timed runs
@@ -328,6 +523,113 @@ static void BM_StaticProbabilityTable_GetOutcomeIndex_128(
 // register this benchmark
 BENCHMARK(BM_StaticProbabilityTable_GetOutcomeIndex_128);
 
+// measure the cost of At for a StaticProbabilityTable object of size 128 with
+// 64-bit weights
+static void BM_StaticProbabilityTable_GetOutcomeIndex_Uint64_128(
+    benchmark::State& state) {
+  auto table_opt = game_dice_cpp::BasicStaticProbabilityTable<std::uint64_t, 128>::Make(
+      {1, 8, 3, 2, 5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 8, 3, 2, 5, 3, 2,
+       5, 8, 5, 4, 8, 2, 1, 8, 1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 1, 1, 3, 2,
+       5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 2, 3, 2, 5, 3, 2, 5, 3, 1, 8,
+       3, 2, 5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 8, 3, 2, 5, 3, 2, 5, 8,
+       5, 4, 8, 2, 1, 8, 1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 1, 1, 3, 2, 5, 2,
+       2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 2, 3, 2, 5, 3, 2, 5, 3});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  std::uint64_t total_weight = table.GetTotalWeight();
+  std::uint64_t input = 1;
+  // some prime number stride helps hit different cache lines and tree depths
+  const std::uint64_t stride = 127;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(input));
+    // alternate increment
+    input = input + stride;
+    if (input > total_weight) {
+      input = (input % total_weight) + 1;
+    }
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticProbabilityTable_GetOutcomeIndex_Uint64_128);
+
+// measure the cost of At for a StaticProbabilityTable object of size 128 with
+// a dense lookup
+static void BM_StaticProbabilityTable_GetOutcomeIndex_Dense_128(
+    benchmark::State& state) {
+  auto table_opt = game_dice_cpp::StaticProbabilityTable<128, 1024>::Make(
+      {1, 8, 3, 2, 5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 8, 3, 2, 5, 3, 2,
+       5, 8, 5, 4, 8, 2, 1, 8, 1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 1, 1, 3, 2,
+       5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 2, 3, 2, 5, 3, 2, 5, 3, 1, 8,
+       3, 2, 5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 8, 3, 2, 5, 3, 2, 5, 8,
+       5, 4, 8, 2, 1, 8, 1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 1, 1, 3, 2, 5, 2,
+       2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 2, 3, 2, 5, 3, 2, 5, 3});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  int total_weight = table.GetTotalWeight();
+  int input = 1;
+  const int stride = 127;  // some prime number stride helps hit different cache
+                           // lines and tree depths
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(input));
+    // alternate increment
+    input = input + stride;
+    if (input > total_weight) {
+      input = (input % total_weight) + 1;
+    }
+  }
+}
+// register this benchmark
+BENCHMARK(BM_StaticProbabilityTable_GetOutcomeIndex_Dense_128);
+
+// measure the cost of GetOutcomeIndexes for a batch of rolls on a
+// StaticProbabilityTable object of size 128
+static void BM_StaticProbabilityTable_GetOutcomeIndexes_128(
+    benchmark::State& state) {
+  auto table_opt = game_dice_cpp::StaticProbabilityTable<128>::Make(
+      {1, 8, 3, 2, 5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 8, 3, 2, 5, 3, 2,
+       5, 8, 5, 4, 8, 2, 1, 8, 1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 1, 1, 3, 2,
+       5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 2, 3, 2, 5, 3, 2, 5, 3, 1, 8,
+       3, 2, 5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 8, 3, 2, 5, 3, 2, 5, 8,
+       5, 4, 8, 2, 1, 8, 1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 1, 1, 3, 2, 5, 2,
+       2, 6, 3, 7, 8, 6, 5, 2, 1, 2, 2, 3, 2, 5, 3, 2, 5, 3});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(static_cast<std::size_t>(state.range(0)));
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::vector<int> outputs(inputs.size());
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    table.GetOutcomeIndexes(inputs, outputs);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(outputs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          state.range(0));
+}
+// register this benchmark
+BENCHMARK(BM_StaticProbabilityTable_GetOutcomeIndexes_128)
+    ->RangeMultiplier(4)
+    ->Range(16, 4096);
+
 // measure the cost of GetTotalWeight for a StaticProbabilityTable object of
 // size 128
 static void BM_StaticProbabilityTable_GetTotalWeight_128(
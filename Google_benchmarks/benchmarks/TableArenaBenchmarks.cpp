@@ -0,0 +1,169 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "TableArena.h"
+
+namespace {
+// Builds count weight lists of 8 to 32 outcomes each.
+//
+// The totals are kept above the dense lookup bound so that both containers use
+// the same binary search.
+std::vector<std::vector<int>> MakeWeightLists(std::size_t count) {
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<std::size_t> size_distribution(8, 32);
+  std::uniform_int_distribution<int> weight_distribution(20, 60);
+  std::vector<std::vector<int>> tables(count);
+  for (auto& weights : tables) {
+    weights.resize(size_distribution(engine));
+    for (int& weight : weights) {
+      weight = weight_distribution(engine);
+    }
+  }
+  return tables;
+}
+}  // namespace
+
+// measure the cost of building many tables into one TableArena and report the
+// memory used per table
+//
+// Run alone under `valgrind --tool=massif` with
+// --benchmark_filter=BM_TableArena_Make to see the heap profile of the arena.
+static void BM_TableArena_Make(benchmark::State& state) {
+  const auto tables = MakeWeightLists(static_cast<std::size_t>(state.range(0)));
+  std::size_t bytes = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    auto arena = game_dice_cpp::TableArena::Make(tables);
+    bytes = arena->GetMemoryUsage();
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(arena);
+  }
+  state.counters["bytes_per_table"] =
+      static_cast<double>(bytes) / static_cast<double>(tables.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// register this benchmark
+BENCHMARK(BM_TableArena_Make)->Arg(1 << 10)->Arg(1 << 17);
+
+// measure the cost of building the same tables as individual
+// DynamicProbabilityTable objects and report the memory used per table
+//
+// The counter excludes allocator overhead (a header per allocation), which
+// Massif shows when run alone with
+// --benchmark_filter=BM_DynamicProbabilityTable_Make_Many.
+static void BM_DynamicProbabilityTable_Make_Many(benchmark::State& state) {
+  const auto tables = MakeWeightLists(static_cast<std::size_t>(state.range(0)));
+  std::size_t bytes = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::vector<game_dice_cpp::DynamicProbabilityTable> built;
+    built.reserve(tables.size());
+    bytes = built.capacity() * sizeof(game_dice_cpp::DynamicProbabilityTable);
+    for (const auto& weights : tables) {
+      built.push_back(*game_dice_cpp::DynamicProbabilityTable::Make(
+          weights, {.dense_lookup_max_weight = 0}));
+      bytes += weights.size() * sizeof(int);
+    }
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(built);
+  }
+  state.counters["bytes_per_table"] =
+      static_cast<double>(bytes) / static_cast<double>(tables.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_Make_Many)->Arg(1 << 10)->Arg(1 << 17);
+
+// measure the cost of a lookup through a TableArena view in a random table
+static void BM_TableArena_GetOutcomeIndex(benchmark::State& state) {
+  const auto tables = MakeWeightLists(static_cast<std::size_t>(state.range(0)));
+  auto arena_opt = game_dice_cpp::TableArena::Make(tables);
+  if (!arena_opt) {
+    state.SkipWithError("Failed to create arena.");
+    return;
+  }
+  const auto& arena = *arena_opt;
+  // pre-pick the tables and rolls so the engine is not part of the measurement
+  auto engine = std::mt19937(7);
+  std::uniform_int_distribution<std::size_t> table_distribution(
+      0, tables.size() - 1);
+  std::vector<std::pair<std::size_t, int>> inputs(4096);
+  for (auto& [table, roll] : inputs) {
+    table = table_distribution(engine);
+    roll = std::uniform_int_distribution<int>(
+        1, arena.GetTable(table).GetTotalWeight())(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    const auto& [table, roll] = inputs[next_input];
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(arena.GetTable(table).GetOutcomeIndex(roll));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_TableArena_GetOutcomeIndex)->Arg(1 << 10)->Arg(1 << 17);
+
+// measure the cost of a lookup in a random DynamicProbabilityTable
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Many(
+    benchmark::State& state) {
+  const auto tables = MakeWeightLists(static_cast<std::size_t>(state.range(0)));
+  std::vector<game_dice_cpp::DynamicProbabilityTable> built;
+  built.reserve(tables.size());
+  for (const auto& weights : tables) {
+    built.push_back(*game_dice_cpp::DynamicProbabilityTable::Make(
+        weights, {.dense_lookup_max_weight = 0}));
+  }
+  // pre-pick the tables and rolls so the engine is not part of the measurement
+  auto engine = std::mt19937(7);
+  std::uniform_int_distribution<std::size_t> table_distribution(
+      0, tables.size() - 1);
+  std::vector<std::pair<std::size_t, int>> inputs(4096);
+  for (auto& [table, roll] : inputs) {
+    table = table_distribution(engine);
+    roll = std::uniform_int_distribution<int>(
+        1, built[table].GetTotalWeight())(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    const auto& [table, roll] = inputs[next_input];
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(built[table].GetOutcomeIndex(roll));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Many)
+    ->Arg(1 << 10)
+    ->Arg(1 << 17);
@@ -0,0 +1,98 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "TableArena.h"
+#include "TableFile.h"
+
+namespace {
+// The number of tables loaded at startup.
+constexpr std::size_t startup_table_count{100'000};
+
+// Builds the weight lists of the startup tables, 8 to 32 outcomes each.
+std::vector<std::vector<int>> MakeStartupWeights() {
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<std::size_t> size_distribution(8, 32);
+  std::uniform_int_distribution<int> weight_distribution(20, 60);
+  std::vector<std::vector<int>> tables(startup_table_count);
+  for (auto& weights : tables) {
+    weights.resize(size_distribution(engine));
+    for (int& weight : weights) {
+      weight = weight_distribution(engine);
+    }
+  }
+  return tables;
+}
+}  // namespace
+
+// measure the cost of loading the startup tables by calling
+// DynamicProbabilityTable::Make once per table (parsing is not included)
+static void BM_TableFile_Startup_Make(benchmark::State& state) {
+  const auto tables = MakeStartupWeights();
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::vector<game_dice_cpp::DynamicProbabilityTable> loaded;
+    loaded.reserve(tables.size());
+    for (const auto& weights : tables) {
+      loaded.push_back(*game_dice_cpp::DynamicProbabilityTable::Make(weights));
+    }
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(loaded);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(startup_table_count));
+}
+// register this benchmark
+BENCHMARK(BM_TableFile_Startup_Make)->Unit(benchmark::kMillisecond);
+
+// measure the cost of loading the same tables by mapping a table file (the
+// file is in the page cache, so this is the checksum and offset checks)
+static void BM_TableFile_Startup_Mmap(benchmark::State& state) {
+  const auto path = std::filesystem::temp_directory_path() /
+                    "game_dice_cpp_table_file_benchmark";
+  if (!game_dice_cpp::SaveTableFile(
+          *game_dice_cpp::TableArena::Make(MakeStartupWeights()), path)) {
+    state.SkipWithError("Failed to write table file.");
+    return;
+  }
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    auto file = game_dice_cpp::MappedTableFile::Open(path);
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(file);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(startup_table_count));
+  std::filesystem::remove(path);
+}
+// register this benchmark
+BENCHMARK(BM_TableFile_Startup_Mmap)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,113 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "TwoLevelProbabilityTable.h"
+
+// measure the cost of making a TwoLevelProbabilityTable object
+static void BM_TwoLevelProbabilityTable_Make(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        game_dice_cpp::TwoLevelProbabilityTable::Make(weights));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_TwoLevelProbabilityTable_Make)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 24);
+
+// measure the cost of lookup in TwoLevelProbabilityTable with random rolls
+static void BM_TwoLevelProbabilityTable_GetOutcomeIndex_Random(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  auto table_opt = game_dice_cpp::TwoLevelProbabilityTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_TwoLevelProbabilityTable_GetOutcomeIndex_Random)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 24)
+    ->Arg(10'000'000)
+    ->Arg(1 << 26);
+
+// measure the cost of lookup in a flat DynamicProbabilityTable with random
+// rolls over the same sweep, for comparison
+static void BM_DynamicProbabilityTable_GetOutcomeIndex_Random_Flat(
+    benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)), 1);
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(
+      weights, {.dense_lookup_max_weight = 0});
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  // pre-roll the inputs so the engine is not part of the measurement
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(1, table.GetTotalWeight());
+  std::vector<int> inputs(4096);
+  for (int& input : inputs) {
+    input = distribution(engine);
+  }
+  std::size_t next_input = 0;
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.GetOutcomeIndex(inputs[next_input]));
+    next_input = (next_input + 1) % inputs.size();
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_GetOutcomeIndex_Random_Flat)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 24)
+    ->Arg(10'000'000)
+    ->Arg(1 << 26);
@@ -0,0 +1,88 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "WeightedDeck.h"
+
+// measure the cost of drawing a whole WeightedDeck and resetting it
+static void BM_WeightedDeck_DrawAll(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 7) + 1;
+  }
+  auto deck_opt = game_dice_cpp::WeightedDeck::Make(weights);
+  if (!deck_opt) {
+    state.SkipWithError("Failed to create deck.");
+    return;
+  }
+  auto& deck = *deck_opt;
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    while (const auto card = deck.Draw(engine)) {
+      // prevent compiler from optimizing the result away
+      benchmark::DoNotOptimize(*card);
+    }
+    deck.Reset();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          state.range(0));
+}
+// register this benchmark
+BENCHMARK(BM_WeightedDeck_DrawAll)->RangeMultiplier(4)->Range(8, 1 << 14);
+
+// measure the cost of drawing a whole deck by rebuilding a
+// DynamicProbabilityTable after every draw
+static void BM_DynamicProbabilityTable_RebuildDrawAll(benchmark::State& state) {
+  std::vector<int> initial_weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < initial_weights.size(); ++i) {
+    initial_weights[i] = static_cast<int>(i % 7) + 1;
+  }
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::vector<int> weights = initial_weights;
+    while (auto table = game_dice_cpp::DynamicProbabilityTable::Make(
+               weights, {.dense_lookup_max_weight = 0})) {
+      std::uniform_int_distribution<int> distribution(1,
+                                                      table->GetTotalWeight());
+      const int card = table->GetOutcomeIndex(distribution(engine));
+      // prevent compiler from optimizing the result away
+      benchmark::DoNotOptimize(card);
+      weights[static_cast<std::size_t>(card)] = 0;
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          state.range(0));
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_RebuildDrawAll)
+    ->RangeMultiplier(4)
+    ->Range(8, 1 << 12);
@@ -0,0 +1,109 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "WeightedReservoir.h"
+
+// measure the cost of selecting k distinct ids from a stream of (id, weight)
+// pairs with the weighted reservoir
+static void BM_WeightedReservoir_Sample(benchmark::State& state) {
+  std::vector<std::pair<int, int>> candidates;
+  for (int id = 0; id < state.range(0); ++id) {
+    candidates.emplace_back(id, (id % 7) + 1);
+  }
+  const auto k = static_cast<std::size_t>(state.range(1));
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(
+        game_dice_cpp::SampleWeightedReservoir(candidates, k, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_WeightedReservoir_Sample)
+    ->ArgsProduct({{1 << 10, 20'000}, {1, 5, 50, 500}});
+
+// measure the cost of selecting k distinct outcomes from an existing
+// DynamicProbabilityTable
+static void BM_DynamicProbabilityTable_SampleDistinct(benchmark::State& state) {
+  std::vector<int> weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 7) + 1;
+  }
+  auto table_opt = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  if (!table_opt) {
+    state.SkipWithError("Failed to create table.");
+    return;
+  }
+  const auto& table = *table_opt;
+  const auto k = static_cast<std::size_t>(state.range(1));
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(table.SampleDistinct(k, engine));
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_SampleDistinct)
+    ->ArgsProduct({{1 << 10, 20'000}, {1, 5, 50, 500}});
+
+// measure the cost of selecting k distinct outcomes by rebuilding a
+// DynamicProbabilityTable after each pick
+static void BM_DynamicProbabilityTable_RebuildSampleDistinct(
+    benchmark::State& state) {
+  std::vector<int> initial_weights(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < initial_weights.size(); ++i) {
+    initial_weights[i] = static_cast<int>(i % 7) + 1;
+  }
+  const auto k = static_cast<std::size_t>(state.range(1));
+  auto engine = std::mt19937_64(42);
+  // the loop where the code to be timed runs
+  for (auto _ : state) {
+    std::vector<int> weights = initial_weights;
+    std::vector<int> sample;
+    while (sample.size() < k) {
+      const auto table = game_dice_cpp::DynamicProbabilityTable::Make(
+          weights, {.dense_lookup_max_weight = 0});
+      std::uniform_int_distribution<int> distribution(1,
+                                                      table->GetTotalWeight());
+      const int outcome = table->GetOutcomeIndex(distribution(engine));
+      sample.push_back(outcome);
+      weights[static_cast<std::size_t>(outcome)] = 0;
+    }
+    // prevent compiler from optimizing the result away
+    benchmark::DoNotOptimize(sample.data());
+  }
+}
+// register this benchmark
+BENCHMARK(BM_DynamicProbabilityTable_RebuildSampleDistinct)
+    ->ArgsProduct({{1 << 10, 20'000}, {1, 5, 50, 500}});
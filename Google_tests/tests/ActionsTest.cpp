@@ -26,7 +26,14 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
 #include "Actions.h"
+#include "PreparedDice.h"
 
 TEST(ActionsTest, RollSameSeedReturnsDeterministicResult) {
   // GIVEN a d20...
@@ -72,4 +79,68 @@ TEST(ActionsTest, RollAnyDieProducesValueInRange) {
           << "].";
     }
   }
-}
\ No newline at end of file
+}
+
+TEST(ActionsTest, RollWideDieProducesValueInRange) {
+  // GIVEN a die with more sides than an int can hold
+  const auto dice = game_dice_cpp::BasicDice<std::uint64_t>(10'000'000'000);
+  std::mt19937_64 rand_generator(42);
+  bool rolled_past_int_max = false;
+  for (int trial = 0; trial <= 1'000; trial++) {
+    // WHEN the dice is rolled
+    const std::uint64_t result = game_dice_cpp::Roll(dice, rand_generator);
+    // THEN the result is always in range
+    EXPECT_THAT(result, testing::AllOf(testing::Ge(1U),
+                                       testing::Le(10'000'000'000U)));
+    rolled_past_int_max |= result > std::numeric_limits<int>::max();
+  }
+  // AND the upper part of the range is reached
+  EXPECT_TRUE(rolled_past_int_max);
+}
+
+TEST(ActionsTest, RollMatchesKnownValues) {
+  // GIVEN a d20 and the two engines whose output the standard fixes
+  const auto d20 = game_dice_cpp::Dice(20);
+  std::mt19937 mt_generator(42);
+  std::minstd_rand minstd_generator(42);
+  // WHEN the dice is rolled ten times with each
+  // THEN the results are the same with every standard library
+  constexpr std::array<int, 10> expected_mt = {8,  16, 20, 4, 15,
+                                               16, 12, 12, 4, 9};
+  constexpr std::array<int, 10> expected_minstd = {19, 3, 17, 12, 4,
+                                                   14, 3, 16, 14, 6};
+  for (std::size_t i = 0; i < expected_mt.size(); ++i) {
+    EXPECT_EQ(game_dice_cpp::Roll(d20, mt_generator), expected_mt[i]);
+    EXPECT_EQ(game_dice_cpp::Roll(d20, minstd_generator), expected_minstd[i]);
+  }
+}
+
+TEST(ActionsTest, RollWideDieMatchesKnownValues) {
+  // GIVEN a 64-bit die and a 32-bit engine
+  const auto dice = game_dice_cpp::BasicDice<std::uint64_t>(10'000'000'000);
+  std::mt19937 rand_generator(42);
+  // WHEN the dice is rolled
+  // THEN each roll consumes two engine outputs and matches the known values
+  constexpr std::array<std::uint64_t, 4> expected = {
+      3'745'401'145, 9'507'143'117, 7'319'939'386, 5'986'584'865};
+  for (const std::uint64_t value : expected) {
+    EXPECT_EQ(game_dice_cpp::Roll(dice, rand_generator), value);
+  }
+}
+
+TEST(ActionsTest, RollPreparedDieMatchesDie) {
+  for (int sides = 2; sides < 40; sides++) {
+    // GIVEN a die and the same die prepared
+    const auto dice = game_dice_cpp::Dice(sides);
+    const auto prepared = game_dice_cpp::PreparedDice(dice);
+    // AND two engines with the same seed
+    std::ranlux24_base rand_generator_a(42);
+    std::ranlux24_base rand_generator_b(42);
+    for (int trial = 0; trial < 100; trial++) {
+      // WHEN both are rolled
+      // THEN the results are the same
+      ASSERT_EQ(game_dice_cpp::Roll(dice, rand_generator_a),
+                game_dice_cpp::Roll(prepared, rand_generator_b));
+    }
+  }
+}
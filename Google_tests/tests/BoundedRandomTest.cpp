@@ -0,0 +1,150 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include "BoundedRandom.h"
+
+namespace {
+// An engine that replays a fixed sequence of 32-bit values.
+class ScriptedEngine {
+ private:
+  std::array<std::uint32_t, 4> values_;
+  std::size_t next_{0};
+
+ public:
+  using result_type = std::uint32_t;
+  explicit ScriptedEngine(const std::array<std::uint32_t, 4>& values)
+      : values_(values) {}
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+  result_type operator()() { return values_[next_++ % values_.size()]; }
+};
+}  // namespace
+
+TEST(BoundedRandomTest, EngineBitsMatchEngineRange) {
+  // GIVEN engines with power-of-two and other ranges
+  // THEN power-of-two ranges supply every bit
+  EXPECT_EQ(game_dice_cpp::EngineBits<std::mt19937>::bits, 32);
+  EXPECT_EQ(game_dice_cpp::EngineBits<std::mt19937_64>::bits, 64);
+  EXPECT_EQ(game_dice_cpp::EngineBits<std::ranlux24_base>::bits, 24);
+  EXPECT_EQ(game_dice_cpp::EngineBits<std::ranlux48>::bits, 48);
+  // AND other ranges supply half of their bits
+  EXPECT_FALSE(game_dice_cpp::EngineBits<std::minstd_rand>::is_power_of_two);
+  EXPECT_EQ(game_dice_cpp::EngineBits<std::minstd_rand>::bits, 16);
+}
+
+TEST(BoundedRandomTest, UniformBitsConcatenatesDraws) {
+  // GIVEN two engines with the same seed
+  std::mt19937 engine(42);
+  std::mt19937 reference(42);
+  // WHEN a 32-bit and a 64-bit value are drawn
+  const auto narrow = game_dice_cpp::UniformBits<std::uint32_t>(engine);
+  const auto wide = game_dice_cpp::UniformBits<std::uint64_t>(engine);
+  // THEN the 32-bit value is a single engine output
+  EXPECT_EQ(narrow, reference());
+  // AND the 64-bit value is the next two outputs, high to low
+  const std::uint64_t high = reference();
+  EXPECT_EQ(wide, (high << 32) | reference());
+}
+
+TEST(BoundedRandomTest, MultiplyWideKeepsHighHalf) {
+  // GIVEN the largest 32- and 64-bit values
+  constexpr auto max32 = std::numeric_limits<std::uint32_t>::max();
+  constexpr auto max64 = std::numeric_limits<std::uint64_t>::max();
+  // WHEN they are squared
+  constexpr auto product32 = game_dice_cpp::MultiplyWide(max32, max32);
+  constexpr auto product64 = game_dice_cpp::MultiplyWide(max64, max64);
+  // THEN (2^N - 1)^2 splits into 2^N - 2 and 1
+  static_assert(product32.high == max32 - 1 && product32.low == 1);
+  static_assert(product64.high == max64 - 1 && product64.low == 1);
+  // AND a product with a carry out of the middle term is exact
+  constexpr auto mixed =
+      game_dice_cpp::MultiplyWide(std::uint64_t{0x0123'4567'89ab'cdefU},
+                                  std::uint64_t{0xfedc'ba98'7654'3210U});
+  static_assert(mixed.high == 0x0121'fa00'ad77'd742U);
+  static_assert(mixed.low == 0x2236'd88f'e561'8cf0U);
+}
+
+TEST(BoundedRandomTest, RejectsBiasedDraw) {
+  // GIVEN a range of 3, whose single biased 32-bit draw is 0
+  const game_dice_cpp::BoundedUniform<std::uint32_t> generator(3);
+  // AND an engine that returns that draw first
+  ScriptedEngine engine({0, 0x8000'0000U, 0, 0});
+  ScriptedEngine reference({0, 0x8000'0000U, 0, 0});
+  // WHEN a value is generated
+  // THEN the biased draw is skipped and the next one decides the result
+  EXPECT_EQ(generator(engine), 1U);
+  EXPECT_EQ(
+      game_dice_cpp::BoundedUniform<std::uint32_t>::Generate(3, reference),
+      1U);
+}
+
+TEST(BoundedRandomTest, PrecomputedThresholdMatchesGenerate) {
+  // GIVEN ranges that are small, large and just past a power of two
+  for (const std::uint64_t range :
+       {std::uint64_t{1}, std::uint64_t{2}, std::uint64_t{6},
+        std::uint64_t{1} << 32, (std::uint64_t{1} << 63) + 1,
+        std::numeric_limits<std::uint64_t>::max()}) {
+    const game_dice_cpp::BoundedUniform<std::uint64_t> generator(range);
+    // AND two engines with the same seed
+    std::mt19937_64 engine_a(7);
+    std::mt19937_64 engine_b(7);
+    for (int trial = 0; trial < 1'000; ++trial) {
+      // WHEN values are generated with and without the threshold
+      const std::uint64_t value_a = generator(engine_a);
+      const std::uint64_t value_b =
+          game_dice_cpp::BoundedUniform<std::uint64_t>::Generate(range,
+                                                                 engine_b);
+      // THEN they are the same and in range
+      ASSERT_EQ(value_a, value_b);
+      ASSERT_LT(value_a, range);
+    }
+  }
+}
+
+TEST(BoundedRandomTest, SmallRangeIsRoughlyUniform) {
+  // GIVEN a range of 6 and a non-power-of-two engine
+  const game_dice_cpp::BoundedUniform<std::uint32_t> generator(6);
+  std::minstd_rand engine(42);
+  std::array<int, 6> counts{};
+  // WHEN many values are generated
+  constexpr int trials = 60'000;
+  for (int trial = 0; trial < trials; ++trial) {
+    ++counts[generator(engine)];
+  }
+  // THEN every value appears close to one time in six
+  for (const int count : counts) {
+    EXPECT_NEAR(count, trials / 6, 500);
+  }
+}
@@ -0,0 +1,105 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include "CompactProbabilityTable.h"
+#include "DynamicProbabilityTable.h"
+
+TEST(CompactProbabilityTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
+  // GIVEN a table defined with no weights
+  const auto table_A =
+      game_dice_cpp::CompactProbabilityTable::Make(std::span<const int>{});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(CompactProbabilityTableTest, MakeWithOverflowWeightsDoesNotConstruct) {
+  // GIVEN a table defined with weights that sum past the limit of an int
+  const auto table_A = game_dice_cpp::CompactProbabilityTable::Make(
+      std::to_array({std::numeric_limits<int>::max(), 1}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(CompactProbabilityTableTest, EveryEncodingMatchesDynamicTable) {
+  // GIVEN weights that need 8, 16 and 32-bit thresholds
+  for (const int scale : {1, 300, 100'000}) {
+    for (const std::size_t size : {1U, 15U, 16U, 17U, 40U}) {
+      std::vector<int> weights(size);
+      for (std::size_t i = 0; i < size; ++i) {
+        weights[i] = static_cast<int>(i % 4) * scale;
+      }
+      weights.back() = scale;
+      const auto dynamic_table =
+          game_dice_cpp::DynamicProbabilityTable::Make(weights);
+      ASSERT_TRUE(dynamic_table.has_value());
+      // WHEN a table is made with each encoding
+      for (const auto encoding :
+           {game_dice_cpp::ThresholdEncoding::kAuto,
+            game_dice_cpp::ThresholdEncoding::kNarrow,
+            game_dice_cpp::ThresholdEncoding::kDeltaBlocks}) {
+        const auto compact_table =
+            game_dice_cpp::CompactProbabilityTable::Make(weights, encoding);
+        ASSERT_TRUE(compact_table.has_value());
+        EXPECT_EQ(compact_table->GetTotalWeight(),
+                  dynamic_table->GetTotalWeight());
+        // THEN rolls around every threshold map to the same outcome
+        const int total_weight = dynamic_table->GetTotalWeight();
+        for (int roll = -1; roll <= total_weight + 1;
+             roll += (scale == 1 ? 1 : scale / 3)) {
+          EXPECT_EQ(compact_table->GetOutcomeIndex(roll),
+                    dynamic_table->GetOutcomeIndex(roll))
+              << "FAILURE: Mismatch for roll " << roll << " with " << size
+              << " outcomes at scale " << scale << ".";
+        }
+        EXPECT_EQ(compact_table->GetOutcomeIndex(total_weight),
+                  dynamic_table->GetOutcomeIndex(total_weight));
+      }
+    }
+  }
+}
+
+TEST(CompactProbabilityTableTest, AutoEncodingPicksTheSmallerFootprint) {
+  // GIVEN small weights with a total that needs 32-bit thresholds
+  const std::vector<int> weights(2'000, 200);
+  // WHEN tables are made with each encoding
+  const auto narrow_table = game_dice_cpp::CompactProbabilityTable::Make(
+      weights, game_dice_cpp::ThresholdEncoding::kNarrow);
+  const auto delta_table = game_dice_cpp::CompactProbabilityTable::Make(
+      weights, game_dice_cpp::ThresholdEncoding::kDeltaBlocks);
+  const auto auto_table = game_dice_cpp::CompactProbabilityTable::Make(weights);
+  // THEN the delta-encoded blocks are smaller and chosen automatically
+  EXPECT_LT(delta_table->GetMemoryUsage(), narrow_table->GetMemoryUsage());
+  EXPECT_EQ(auto_table->GetEncoding(),
+            game_dice_cpp::ThresholdEncoding::kDeltaBlocks);
+  // AND both use far less than a table of ints
+  EXPECT_LT(delta_table->GetMemoryUsage(), weights.size() * sizeof(int) / 3);
+}
@@ -25,6 +25,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
+
 #include "Dice.h"
 
 TEST(DiceTest, ConstructorValidInputSetsSides) {
@@ -71,3 +74,31 @@ TEST(DiceTest, ConstructorLargeInputSetsSides) {
   EXPECT_EQ(dz.GetNumSides(), std::numeric_limits<int>::max() - 1)
       << "FAILURE: Unexpected number of sides for Dice(large_value).";
 }
+
+TEST(DiceTest, WideDiceKeepSidesPastIntMax) {
+  // GIVEN a number of sides that does not fit in an int
+  const std::uint64_t sides = 10'000'000'000;
+  // WHEN a 64-bit Dice is constructed
+  const auto dice = game_dice_cpp::BasicDice<std::uint64_t>(sides);
+  // THEN the number of sides is kept
+  EXPECT_EQ(dice.GetNumSides(), sides);
+  // AND the maximum is clamped like the default Dice
+  EXPECT_EQ(game_dice_cpp::BasicDice<std::uint64_t>(
+                std::numeric_limits<std::uint64_t>::max())
+                .GetNumSides(),
+            std::numeric_limits<std::uint64_t>::max() - 1);
+}
+
+TEST(DiceTest, NarrowDiceClampSidesToTheirType) {
+  // GIVEN 8-bit and 16-bit side types
+  // WHEN Dice are constructed at the limits of each type
+  // THEN the sides are clamped like the default Dice
+  static_assert(game_dice_cpp::BasicDice<std::int8_t>(1).GetNumSides() == 2);
+  static_assert(game_dice_cpp::BasicDice<std::int8_t>(127).GetNumSides() ==
+                126);
+  static_assert(game_dice_cpp::BasicDice<std::uint8_t>(255).GetNumSides() ==
+                254);
+  static_assert(
+      game_dice_cpp::BasicDice<std::uint16_t>(600).GetNumSides() == 600);
+  EXPECT_EQ(game_dice_cpp::BasicDice<std::int16_t>(6).GetNumSides(), 6);
+}
@@ -0,0 +1,150 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "DynamicAliasTable.h"
+
+TEST(DynamicAliasTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
+  // GIVEN a table defined with no weights
+  const auto table_A =
+      game_dice_cpp::DynamicAliasTable::Make(std::span<const int>{});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(DynamicAliasTableTest, MakeWithAllZeroWeightsReturnsNullOpt) {
+  // GIVEN a table defined with zero weights
+  const auto table_A =
+      game_dice_cpp::DynamicAliasTable::Make(std::to_array({0}));
+  const auto table_B =
+      game_dice_cpp::DynamicAliasTable::Make(std::to_array({0, 0, 0}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+  EXPECT_FALSE(table_B.has_value());
+}
+
+TEST(DynamicAliasTableTest, MakeWithNegativeWeightsReturnsNullOpt) {
+  // GIVEN a table defined with negative weights
+  const auto table_A =
+      game_dice_cpp::DynamicAliasTable::Make(std::to_array({-1, -2, -1}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(DynamicAliasTableTest, MakeWithOverflowWeightsDoesNotConstruct) {
+  // GIVEN a table defined with weights that sum past the limit of an int
+  const auto table_A = game_dice_cpp::DynamicAliasTable::Make(std::to_array(
+      {std::numeric_limits<int>::max(), std::numeric_limits<int>::max(),
+       std::numeric_limits<int>::max(), -1230}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(DynamicAliasTableTest, GetTotalWeightWithMixedWeightsHasCorrectTotalWeight) {
+  // GIVEN a table defined with positive, zero and negative weights
+  const auto table_A =
+      game_dice_cpp::DynamicAliasTable::Make(std::to_array({0, 2, 3}));
+  const auto table_B =
+      game_dice_cpp::DynamicAliasTable::Make(std::to_array({1, -2, 3}));
+  // WHEN GetTotalWeight is called
+  // THEN the total weight matches the sum of non-negative input values
+  EXPECT_EQ(table_A->GetTotalWeight(), 5);
+  EXPECT_EQ(table_B->GetTotalWeight(), 4);
+  // AND the roll range has one column per outcome
+  EXPECT_EQ(table_A->GetRollRange(), 15U);
+  EXPECT_EQ(table_B->GetRollRange(), 12U);
+}
+
+TEST(DynamicAliasTableTest, GetOutcomeIndexCoversEveryRollExactlyByWeight) {
+  // GIVEN tables defined with assorted weights
+  const std::vector<std::vector<int>> weight_lists = {
+      {1},          {1, 2},       {0, 2, 3},    {1, 0, 3},
+      {1, 2, 0},    {2, 1, 1},    {1, -2, 1},   {7, 1, 1, 1, 1, 1, 1},
+      {1, 2, 3, 4}, {100, 1, 50}, {3, 3, 3, 3}, {0, 0, 9, 0, 1}};
+  for (const auto& weights : weight_lists) {
+    const auto table = game_dice_cpp::DynamicAliasTable::Make(weights);
+    ASSERT_TRUE(table.has_value());
+    // WHEN every roll in the range is mapped to an outcome
+    std::vector<std::uint64_t> counts(weights.size(), 0);
+    for (std::uint64_t roll = 1; roll <= table->GetRollRange(); ++roll) {
+      counts[static_cast<std::size_t>(table->GetOutcomeIndex(roll))]++;
+    }
+    // THEN each outcome owns exactly weight * number_of_outcomes rolls
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      EXPECT_EQ(counts[i], static_cast<std::uint64_t>(std::max(weights[i], 0)) *
+                               weights.size())
+          << "FAILURE: Outcome " << i << " has the wrong share of rolls.";
+    }
+  }
+}
+
+TEST(DynamicAliasTableTest, GetOutcomeIndexClampsOutOfRangeRolls) {
+  // GIVEN a table defined with known weights
+  const auto table_A =
+      game_dice_cpp::DynamicAliasTable::Make(std::to_array({1, 2, 3}));
+  // WHEN a roll outside of the range is used
+  // THEN it is treated as the nearest roll inside the range
+  EXPECT_EQ(table_A->GetOutcomeIndex(0), table_A->GetOutcomeIndex(1));
+  EXPECT_EQ(table_A->GetOutcomeIndex(table_A->GetRollRange() + 1),
+            table_A->GetOutcomeIndex(table_A->GetRollRange()));
+}
+
+TEST(DynamicAliasTableTest, SampleSameSeedReturnsDeterministicResult) {
+  // GIVEN a table defined with known weights
+  const auto table_A =
+      game_dice_cpp::DynamicAliasTable::Make(std::to_array({5, 0, 3, 2}));
+  // AND two random number generators with the same seed
+  std::mt19937_64 rand_generator_a(42);
+  std::mt19937_64 rand_generator_b(42);
+  for (int trial = 0; trial < 1'000; trial++) {
+    // WHEN the table is sampled
+    const int result_a = table_A->Sample(rand_generator_a);
+    const int result_b = table_A->Sample(rand_generator_b);
+    // THEN the results are the same
+    EXPECT_EQ(result_a, result_b);
+    // AND an outcome with zero weight is never selected
+    EXPECT_NE(result_a, 1);
+  }
+}
+
+TEST(DynamicAliasTableTest,
+     GetTotalWeightWithLargeInputSizeHasCorrectTotalWeight) {
+  // GIVEN a table defined with known weights
+  const std::vector<int> large_weights_list(1'000'000, 1);
+  const auto table_A =
+      game_dice_cpp::DynamicAliasTable::Make(large_weights_list);
+  // WHEN GetTotalWeight is called
+  // THEN it has the correct total weight
+  EXPECT_EQ(table_A->GetTotalWeight(), 1'000'000);
+}
@@ -25,6 +25,18 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <utility>
+#include <vector>
+
 #include "DynamicProbabilityTable.h"
 
 TEST(DynamicProbabilityTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
@@ -491,3 +503,432 @@ TEST(DynamicProbabilityTableTest,
   // THEN it has the correct total weight
   EXPECT_EQ(table_A->GetTotalWeight(), 1'000'000);
 }
+
+TEST(DynamicProbabilityTableTest,
+     GetOutcomeIndexesMatchesGetOutcomeIndexForEveryRoll) {
+  // GIVEN tables of assorted sizes with sparse weights
+  for (const std::size_t size : {1U, 2U, 3U, 7U, 8U, 9U, 100U, 1'000U}) {
+    std::vector<int> weights(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      weights[i] = static_cast<int>(i % 4);
+    }
+    weights.back() = 3;
+    const auto table_A = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+    ASSERT_TRUE(table_A.has_value());
+    // AND a batch of rolls that is not a multiple of the interleaving width
+    std::vector<int> rolls;
+    for (int roll = -2; roll <= table_A->GetTotalWeight() + 2; ++roll) {
+      rolls.push_back(roll);
+    }
+    // WHEN the batch is mapped in one call
+    std::vector<int> out_indexes(rolls.size(), -1);
+    table_A->GetOutcomeIndexes(rolls, out_indexes);
+    // THEN every result matches a single lookup
+    for (std::size_t i = 0; i < rolls.size(); ++i) {
+      EXPECT_EQ(out_indexes[i], table_A->GetOutcomeIndex(rolls[i]))
+          << "FAILURE: Mismatch for roll " << rolls[i] << " with " << size
+          << " outcomes.";
+    }
+  }
+}
+
+TEST(DynamicProbabilityTableTest,
+     GetOutcomeIndexesWithShortOutputOnlyWritesOutput) {
+  // GIVEN a table and more rolls than there is room for results
+  const auto table_A =
+      game_dice_cpp::DynamicProbabilityTable::Make(std::to_array({1, 2, 3}));
+  const auto rolls = std::to_array({1, 2, 3, 4, 5, 6});
+  std::array<int, 3> out_indexes{};
+  // WHEN the batch is mapped
+  table_A->GetOutcomeIndexes(rolls, out_indexes);
+  // THEN only the rolls with room for a result are mapped
+  EXPECT_EQ(out_indexes, std::to_array({0, 1, 1}));
+}
+
+TEST(DynamicProbabilityTableTest, GuideTableMatchesPlainLookupForEveryRoll) {
+  // GIVEN skewed weights with zero weight outcomes
+  std::vector<int> weights(300);
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>((i * i) % 11);
+  }
+  const auto plain_table =
+      game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  ASSERT_TRUE(plain_table.has_value());
+  // WHEN tables are built with guide tables of assorted sizes
+  for (const std::size_t guide_table_size : {1U, 2U, 7U, 64U, 300U, 5'000U}) {
+    const auto guided_table = game_dice_cpp::DynamicProbabilityTable::Make(
+        weights, {.guide_table_size = guide_table_size});
+    ASSERT_TRUE(guided_table.has_value());
+    // THEN every roll, including out of range rolls, maps to the same outcome
+    for (int roll = -2; roll <= plain_table->GetTotalWeight() + 2; ++roll) {
+      EXPECT_EQ(guided_table->GetOutcomeIndex(roll),
+                plain_table->GetOutcomeIndex(roll))
+          << "FAILURE: Mismatch for roll " << roll << " with guide size "
+          << guide_table_size << ".";
+    }
+  }
+}
+
+TEST(DynamicProbabilityTableTest, GuideTableHandlesTrailingZeroWeights) {
+  // GIVEN weights that end in zero weight outcomes
+  const auto table_A = game_dice_cpp::DynamicProbabilityTable::Make(
+      std::to_array({0, 4, 0, 3, 0, 0}), {.guide_table_size = 4});
+  ASSERT_TRUE(table_A.has_value());
+  // WHEN every roll is looked up
+  // THEN the zero weight outcomes are only reached by clamping
+  EXPECT_EQ(table_A->GetOutcomeIndex(0), 0);
+  EXPECT_EQ(table_A->GetOutcomeIndex(1), 1);
+  EXPECT_EQ(table_A->GetOutcomeIndex(4), 1);
+  EXPECT_EQ(table_A->GetOutcomeIndex(5), 3);
+  EXPECT_EQ(table_A->GetOutcomeIndex(7), 3);
+  EXPECT_EQ(table_A->GetOutcomeIndex(8), 5);
+}
+
+TEST(DynamicProbabilityTableTest, DenseLookupMatchesSearchForEveryRoll) {
+  // GIVEN percent-style weights with zero weight outcomes at both ends
+  const auto weights = std::to_array({0, 10, 25, 0, 40, 20, 5, 0});
+  // WHEN one table uses a dense lookup and another searches
+  const auto dense_table = game_dice_cpp::DynamicProbabilityTable::Make(
+      weights, {.dense_lookup_max_weight = 100});
+  const auto search_table = game_dice_cpp::DynamicProbabilityTable::Make(
+      weights, {.dense_lookup_max_weight = 0});
+  ASSERT_TRUE(dense_table.has_value());
+  ASSERT_TRUE(search_table.has_value());
+  // THEN every roll, including out of range rolls, maps to the same outcome
+  for (int roll = -5; roll <= 105; ++roll) {
+    EXPECT_EQ(dense_table->GetOutcomeIndex(roll),
+              search_table->GetOutcomeIndex(roll))
+        << "FAILURE: Mismatch for roll " << roll << ".";
+  }
+}
+
+TEST(DynamicProbabilityTableTest, DenseLookupIsOffByDefault) {
+  // GIVEN a small table built with the default options
+  const auto table_A =
+      game_dice_cpp::DynamicProbabilityTable::Make(std::to_array({1, 2, 3}));
+  ASSERT_TRUE(table_A.has_value());
+  // THEN it does not build a dense lookup table
+  EXPECT_FALSE(table_A->HasDenseLookup());
+}
+
+TEST(DynamicProbabilityTableTest, DenseLookupBoundIsCapped) {
+  // GIVEN a total weight just past the largest dense lookup table
+  constexpr int limit =
+      game_dice_cpp::DynamicProbabilityTableOptions::dense_lookup_weight_limit;
+  // WHEN the table is built with an unbounded dense lookup
+  const auto table_A = game_dice_cpp::DynamicProbabilityTable::Make(
+      std::to_array({limit / 2, limit / 2 + 1}),
+      {.dense_lookup_max_weight = std::numeric_limits<int>::max()});
+  ASSERT_TRUE(table_A.has_value());
+  // THEN no dense lookup table is built
+  EXPECT_FALSE(table_A->HasDenseLookup());
+  EXPECT_EQ(table_A->GetOutcomeIndex(limit / 2 + 1), 1);
+}
+
+TEST(DynamicProbabilityTableTest, DenseLookupHandlesExtremeRolls) {
+  // GIVEN a table small enough for a dense lookup
+  const auto table_A = game_dice_cpp::DynamicProbabilityTable::Make(
+      std::to_array({1, 2, 3}), {.dense_lookup_max_weight = 6});
+  ASSERT_TRUE(table_A.has_value());
+  ASSERT_TRUE(table_A->HasDenseLookup());
+  // WHEN the most extreme rolls are looked up
+  // THEN they clamp to the first and last outcomes
+  EXPECT_EQ(table_A->GetOutcomeIndex(std::numeric_limits<int>::min()), 0);
+  EXPECT_EQ(table_A->GetOutcomeIndex(std::numeric_limits<int>::max()), 2);
+}
+
+TEST(DynamicProbabilityTableTest, SampleDistinctReturnsDistinctWeightedOutcomes) {
+  // GIVEN a table with zero weight outcomes
+  const auto table_A = game_dice_cpp::DynamicProbabilityTable::Make(
+      std::to_array({0, 3, 0, 1, 4, 0, 2}));
+  ASSERT_TRUE(table_A.has_value());
+  auto engine = std::mt19937(42);
+  // WHEN small and oversized samples are taken
+  std::vector<int> small_sample = table_A->SampleDistinct(2, engine);
+  std::vector<int> full_sample = table_A->SampleDistinct(100, engine);
+  // THEN the samples hold distinct outcomes with weight
+  ASSERT_EQ(small_sample.size(), 2U);
+  EXPECT_NE(small_sample[0], small_sample[1]);
+  std::ranges::sort(full_sample);
+  EXPECT_EQ(full_sample, std::vector<int>({1, 3, 4, 6}));
+  EXPECT_TRUE(table_A->SampleDistinct(0, engine).empty());
+}
+
+TEST(DynamicProbabilityTableTest, Uint64WeightsHoldTotalsPastIntMax) {
+  // GIVEN a one-in-ten-billion jackpot that an int table cannot hold
+  const auto table_A =
+      game_dice_cpp::BasicDynamicProbabilityTable<std::uint64_t>::Make(
+          std::to_array<std::uint64_t>({1, 9'999'999'999}));
+  ASSERT_TRUE(table_A.has_value());
+  // WHEN rolls at the edges of each outcome are looked up
+  // THEN they map to the correct outcome
+  EXPECT_EQ(table_A->GetTotalWeight(), 10'000'000'000U);
+  EXPECT_EQ(table_A->GetOutcomeIndex(0), 0);
+  EXPECT_EQ(table_A->GetOutcomeIndex(1), 0);
+  EXPECT_EQ(table_A->GetOutcomeIndex(2), 1);
+  EXPECT_EQ(table_A->GetOutcomeIndex(10'000'000'000), 1);
+  EXPECT_EQ(table_A->GetOutcomeIndex(std::numeric_limits<std::uint64_t>::max()),
+            1);
+}
+
+TEST(DynamicProbabilityTableTest, Uint64WeightsThatOverflowDoNotConstruct) {
+  // GIVEN weights that sum past the limit of a uint64_t
+  const auto table_A =
+      game_dice_cpp::BasicDynamicProbabilityTable<std::uint64_t>::Make(
+          std::to_array<std::uint64_t>(
+              {std::numeric_limits<std::uint64_t>::max(), 1}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+// Checks that a table of narrow weights matches an int table of the same
+// weights for every roll the weight type can hold, with a plain search, a
+// guide table and a dense lookup.
+template <typename Weight>
+void ExpectNarrowTableMatchesIntTable(const std::vector<Weight>& weights) {
+  const std::vector<int> int_weights(weights.begin(), weights.end());
+  const auto int_table =
+      game_dice_cpp::DynamicProbabilityTable::Make(int_weights);
+  ASSERT_TRUE(int_table.has_value());
+  const std::array<game_dice_cpp::DynamicProbabilityTableOptions, 3> options = {
+      {{},
+       {.guide_table_size = 16},
+       {.dense_lookup_max_weight = game_dice_cpp::
+            DynamicProbabilityTableOptions::dense_lookup_weight_limit}}};
+  for (const auto& option : options) {
+    const auto table =
+        game_dice_cpp::BasicDynamicProbabilityTable<Weight>::Make(weights,
+                                                                  option);
+    ASSERT_TRUE(table.has_value());
+    EXPECT_EQ(table->HasDenseLookup(), option.dense_lookup_max_weight > 0);
+    EXPECT_EQ(table->GetTotalWeight(), int_table->GetTotalWeight());
+    for (int roll = std::numeric_limits<Weight>::min();
+         roll <= std::numeric_limits<Weight>::max(); ++roll) {
+      EXPECT_EQ(table->GetOutcomeIndex(static_cast<Weight>(roll)),
+                int_table->GetOutcomeIndex(roll))
+          << "FAILURE: Mismatch for roll " << roll << ".";
+    }
+  }
+}
+
+TEST(DynamicProbabilityTableTest, NarrowWeightsMatchIntTable) {
+  // GIVEN 8-bit and 16-bit weights, including totals at the type's maximum
+  // WHEN every roll the type can hold is looked up
+  // THEN the table agrees with an int table, whichever lookup it uses
+  ExpectNarrowTableMatchesIntTable<std::int8_t>({3, 0, -2, 4});
+  ExpectNarrowTableMatchesIntTable<std::int8_t>({100, 27});
+  ExpectNarrowTableMatchesIntTable<std::uint8_t>({3, 0, 4});
+  ExpectNarrowTableMatchesIntTable<std::uint8_t>({200, 55});
+  ExpectNarrowTableMatchesIntTable<std::int16_t>({32'000, 0, 767});
+}
+
+TEST(DynamicProbabilityTableTest, Uint64GuideTableMatchesPlainLookup) {
+  // GIVEN wide weights with and without a guide table
+  std::vector<std::uint64_t> weights(50);
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = (i % 3 == 0) ? 0 : 100'000'000 * (i + 1);
+  }
+  const auto plain_table =
+      game_dice_cpp::BasicDynamicProbabilityTable<std::uint64_t>::Make(weights);
+  const auto guided_table =
+      game_dice_cpp::BasicDynamicProbabilityTable<std::uint64_t>::Make(
+          weights, {.guide_table_size = 16});
+  ASSERT_TRUE(plain_table.has_value());
+  ASSERT_TRUE(guided_table.has_value());
+  // WHEN rolls across the whole range are looked up
+  // THEN both tables agree
+  const std::uint64_t total_weight = plain_table->GetTotalWeight();
+  for (std::uint64_t roll = 0; roll <= total_weight + 1;
+       roll += total_weight / 997) {
+    EXPECT_EQ(guided_table->GetOutcomeIndex(roll),
+              plain_table->GetOutcomeIndex(roll))
+        << "FAILURE: Mismatch for roll " << roll << ".";
+  }
+}
+
+TEST(DynamicProbabilityTableTest, PmrTableAllocatesOnlyFromTheResource) {
+  // GIVEN an arena that cannot fall back to the global heap
+  std::array<std::byte, 4096> buffer{};
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource());
+  const auto weights = std::to_array({1, 0, 2, 3});
+  // WHEN tables with each lookup structure are made from the arena
+  const auto dense_table =
+      game_dice_cpp::pmr::DynamicProbabilityTable::Make(weights, {}, &arena);
+  const auto guided_table = game_dice_cpp::pmr::DynamicProbabilityTable::Make(
+      weights, {.guide_table_size = 4, .dense_lookup_max_weight = 0}, &arena);
+  const auto expected = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  // THEN the tables are built without throwing std::bad_alloc and agree with
+  // the default table
+  ASSERT_TRUE(dense_table.has_value());
+  ASSERT_TRUE(guided_table.has_value());
+  ASSERT_TRUE(expected.has_value());
+  for (int roll = -1; roll <= expected->GetTotalWeight() + 1; ++roll) {
+    EXPECT_EQ(dense_table->GetOutcomeIndex(roll),
+              expected->GetOutcomeIndex(roll));
+    EXPECT_EQ(guided_table->GetOutcomeIndex(roll),
+              expected->GetOutcomeIndex(roll));
+  }
+}
+
+TEST(DynamicProbabilityTableTest, MakeFromInputRangeMatchesMakeFromSpan) {
+  // GIVEN weights that can only be read once, from a stream
+  const auto weights = std::to_array({3, 0, -2, 5, 1});
+  std::istringstream stream("3 0 -2 5 1");
+  // WHEN a table is made from the stream and from a span
+  const auto streamed_table = game_dice_cpp::DynamicProbabilityTable::Make(
+      std::views::istream<int>(stream));
+  const auto span_table = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  // THEN both tables agree for every roll
+  ASSERT_TRUE(streamed_table.has_value());
+  ASSERT_TRUE(span_table.has_value());
+  ASSERT_EQ(streamed_table->GetTotalWeight(), span_table->GetTotalWeight());
+  for (int roll = -1; roll <= span_table->GetTotalWeight() + 1; ++roll) {
+    EXPECT_EQ(streamed_table->GetOutcomeIndex(roll),
+              span_table->GetOutcomeIndex(roll));
+  }
+}
+
+TEST(DynamicProbabilityTableTest, MakeFromInputRangeRejectsInvalidWeights) {
+  // GIVEN generated weights that sum to nothing or overflow
+  const auto no_weight = std::views::iota(0, 10) |
+                         std::views::transform([](int i) { return -i; });
+  const auto overflow = std::views::iota(0, 3) | std::views::transform([](int) {
+                          return std::numeric_limits<int>::max() / 2;
+                        });
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(game_dice_cpp::DynamicProbabilityTable::Make(no_weight));
+  EXPECT_FALSE(game_dice_cpp::DynamicProbabilityTable::Make(overflow));
+  EXPECT_FALSE(game_dice_cpp::DynamicProbabilityTable::Make(
+      std::views::empty<int>));
+}
+
+TEST(DynamicProbabilityTableTest, ParallelBuildMatchesSerialBuild) {
+  // GIVEN a large table built on one thread and on four threads
+  std::vector<int> weights(std::size_t{1} << 18);
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 7) - 1;
+  }
+  const auto serial_table = game_dice_cpp::DynamicProbabilityTable::Make(
+      std::span<const int>(weights));
+  const auto parallel_table = game_dice_cpp::DynamicProbabilityTable::Make(
+      std::span<const int>(weights), {.build_threads = 4});
+  ASSERT_TRUE(serial_table.has_value());
+  ASSERT_TRUE(parallel_table.has_value());
+  // WHEN rolls across the whole range are looked up
+  // THEN both tables agree
+  ASSERT_EQ(parallel_table->GetTotalWeight(), serial_table->GetTotalWeight());
+  for (int roll = 0; roll <= serial_table->GetTotalWeight() + 1; roll += 97) {
+    EXPECT_EQ(parallel_table->GetOutcomeIndex(roll),
+              serial_table->GetOutcomeIndex(roll));
+  }
+}
+
+namespace {
+// A memory resource that counts the allocations passed to the heap.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t allocations{0};
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* pointer, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+  [[nodiscard]] bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+TEST(DynamicProbabilityTableTest, RebuildMatchesMake) {
+  // GIVEN a table and new weights for every kind of lookup
+  const auto first_weights = std::to_array({1, 2, 3});
+  const std::vector<int> dense_weights = {4, 0, -1, 9};
+  std::vector<int> guided_weights(100);
+  for (std::size_t i = 0; i < guided_weights.size(); ++i) {
+    guided_weights[i] = static_cast<int>(i % 9) * 50;
+  }
+  const game_dice_cpp::DynamicProbabilityTableOptions default_options{};
+  const game_dice_cpp::DynamicProbabilityTableOptions guided_options = {
+      .guide_table_size = 32};
+  auto table = game_dice_cpp::DynamicProbabilityTable::Make(first_weights);
+  ASSERT_TRUE(table.has_value());
+  for (const auto& [weights, options] :
+       {std::pair(dense_weights, default_options),
+        std::pair(guided_weights, guided_options),
+        std::pair(dense_weights, guided_options)}) {
+    // WHEN the table is rebuilt
+    ASSERT_TRUE(table->Rebuild(weights, options));
+    // THEN it agrees with a table made from the same weights for every roll
+    const auto expected =
+        game_dice_cpp::DynamicProbabilityTable::Make(weights, options);
+    ASSERT_TRUE(expected.has_value());
+    ASSERT_EQ(table->GetTotalWeight(), expected->GetTotalWeight());
+    for (int roll = -1; roll <= expected->GetTotalWeight() + 1; ++roll) {
+      EXPECT_EQ(table->GetOutcomeIndex(roll), expected->GetOutcomeIndex(roll));
+    }
+  }
+}
+
+TEST(DynamicProbabilityTableTest, RebuildWithInvalidWeightsKeepsTable) {
+  // GIVEN a table
+  auto table =
+      game_dice_cpp::DynamicProbabilityTable::Make(std::to_array({1, 2, 3}));
+  ASSERT_TRUE(table.has_value());
+  // WHEN it is rebuilt with empty, all zero or overflowing weights
+  // THEN every rebuild fails
+  EXPECT_FALSE(table->Rebuild(std::span<const int>{}));
+  EXPECT_FALSE(table->Rebuild(std::to_array({0, -4})));
+  EXPECT_FALSE(
+      table->Rebuild(std::to_array({std::numeric_limits<int>::max(), 1})));
+  // THEN the table still holds the original weights
+  EXPECT_EQ(table->GetTotalWeight(), 6);
+  EXPECT_EQ(table->GetOutcomeIndex(1), 0);
+  EXPECT_EQ(table->GetOutcomeIndex(3), 1);
+  EXPECT_EQ(table->GetOutcomeIndex(6), 2);
+}
+
+TEST(DynamicProbabilityTableTest, RebuildWithinCapacityDoesNotAllocate) {
+  // GIVEN a table that allocates from a counting resource
+  CountingResource resource;
+  std::vector<int> weights(500, 3);
+  const game_dice_cpp::DynamicProbabilityTableOptions options = {
+      .guide_table_size = 64, .dense_lookup_max_weight = 0};
+  auto table = game_dice_cpp::pmr::DynamicProbabilityTable::Make(
+      weights, options, &resource);
+  ASSERT_TRUE(table.has_value());
+  const std::size_t allocations_after_make = resource.allocations;
+  // WHEN it is rebuilt with fewer outcomes and the same total weight
+  for (const int size : {500, 300, 100}) {
+    weights.assign(static_cast<std::size_t>(size), 1'500 / size);
+    ASSERT_TRUE(table->Rebuild(weights, options));
+  }
+  // THEN nothing new is allocated
+  EXPECT_EQ(resource.allocations, allocations_after_make);
+}
+
+TEST(DynamicProbabilityTableTest, PmrParallelBuildAllocatesFromTheResource) {
+  // GIVEN a large table built from counting resources on one and four threads
+  const std::vector<int> weights(std::size_t{1} << 18, 1);
+  CountingResource serial_resource;
+  CountingResource parallel_resource;
+  const auto serial_table = game_dice_cpp::pmr::DynamicProbabilityTable::Make(
+      weights, {.build_threads = 1}, &serial_resource);
+  // WHEN the build is split into chunks
+  const auto parallel_table =
+      game_dice_cpp::pmr::DynamicProbabilityTable::Make(
+          weights, {.build_threads = 4}, &parallel_resource);
+  // THEN the chunk bookkeeping also comes from the resource
+  ASSERT_TRUE(serial_table.has_value());
+  ASSERT_TRUE(parallel_table.has_value());
+  EXPECT_GT(parallel_resource.allocations, serial_resource.allocations);
+  EXPECT_EQ(parallel_table->GetTotalWeight(), serial_table->GetTotalWeight());
+}
@@ -0,0 +1,128 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "DynamicProbabilityTableView.h"
+
+TEST(DynamicProbabilityTableViewTest, MakeWithEmptyThresholdsReturnsNullOpt) {
+  // GIVEN no thresholds
+  const auto view_A =
+      game_dice_cpp::DynamicProbabilityTableView::Make(std::span<const int>{});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(view_A.has_value());
+}
+
+TEST(DynamicProbabilityTableViewTest, MakeWithInvalidThresholdsReturnsNullOpt) {
+  // GIVEN thresholds that decrease, start below zero or sum to nothing
+  const auto decreasing = std::to_array({1, 3, 2});
+  const auto negative = std::to_array({-1, 2, 3});
+  const auto all_zero = std::to_array({0, 0});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(game_dice_cpp::DynamicProbabilityTableView::Make(decreasing));
+  EXPECT_FALSE(game_dice_cpp::DynamicProbabilityTableView::Make(negative));
+  EXPECT_FALSE(game_dice_cpp::DynamicProbabilityTableView::Make(all_zero));
+}
+
+TEST(DynamicProbabilityTableViewTest, ViewDoesNotCopyTheThresholds) {
+  // GIVEN thresholds owned by the caller
+  const auto thresholds = std::to_array({0, 2, 2, 7});
+  // WHEN a view is made
+  const auto view =
+      game_dice_cpp::DynamicProbabilityTableView::Make(thresholds);
+  // THEN the view reads the caller's buffer
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(view->GetThresholds().data(), thresholds.data());
+  EXPECT_EQ(view->GetTotalWeight(), 7);
+}
+
+TEST(DynamicProbabilityTableViewTest, ViewMatchesDynamicTable) {
+  // GIVEN the thresholds of a table with zero weight outcomes
+  const auto weights = std::to_array({0, 3, 0, 0, 1, 5, 0});
+  std::vector<int> thresholds;
+  int threshold = 0;
+  for (const int weight : weights) {
+    threshold += weight;
+    thresholds.push_back(threshold);
+  }
+  const auto table = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  const auto checked =
+      game_dice_cpp::DynamicProbabilityTableView::Make(thresholds);
+  const auto trusted =
+      game_dice_cpp::DynamicProbabilityTableView::MakeTrusted(thresholds);
+  ASSERT_TRUE(table.has_value());
+  ASSERT_TRUE(checked.has_value());
+  // WHEN every roll, including out of range rolls, is looked up
+  // THEN both views agree with the table
+  for (int roll = -1; roll <= table->GetTotalWeight() + 1; ++roll) {
+    EXPECT_EQ(checked->GetOutcomeIndex(roll), table->GetOutcomeIndex(roll))
+        << "FAILURE: Mismatch for roll " << roll << ".";
+    EXPECT_EQ(trusted.GetOutcomeIndex(roll), table->GetOutcomeIndex(roll))
+        << "FAILURE: Mismatch for roll " << roll << ".";
+  }
+}
+
+TEST(DynamicProbabilityTableViewTest, GetOutcomeIndexesMatchesGetOutcomeIndex) {
+  // GIVEN a view and a batch of rolls
+  const auto thresholds = std::to_array({1, 4, 4, 9, 10});
+  const auto view =
+      game_dice_cpp::DynamicProbabilityTableView::Make(thresholds);
+  ASSERT_TRUE(view.has_value());
+  std::array<int, 12> rolls{};
+  for (std::size_t i = 0; i < rolls.size(); ++i) {
+    rolls[i] = static_cast<int>(i);
+  }
+  // WHEN the batch is looked up
+  std::array<int, 12> indexes{};
+  view->GetOutcomeIndexes(rolls, indexes);
+  // THEN every index matches a single lookup
+  for (std::size_t i = 0; i < rolls.size(); ++i) {
+    EXPECT_EQ(indexes[i], view->GetOutcomeIndex(rolls[i]));
+  }
+}
+
+TEST(DynamicProbabilityTableViewTest, Uint64ViewHoldsTotalsPastIntMax) {
+  // GIVEN wide thresholds
+  const auto thresholds =
+      std::to_array<std::uint64_t>({1, 10'000'000'001, 10'000'000'002});
+  // WHEN a view is made
+  const auto view =
+      game_dice_cpp::BasicDynamicProbabilityTableView<std::uint64_t>::Make(
+          thresholds);
+  // THEN the lookups cover the whole range
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(view->GetOutcomeIndex(2), 1);
+  EXPECT_EQ(view->GetOutcomeIndex(10'000'000'002), 2);
+  EXPECT_EQ(view->GetOutcomeIndex(std::numeric_limits<std::uint64_t>::max()),
+            2);
+}
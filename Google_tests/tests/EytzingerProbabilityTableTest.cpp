@@ -0,0 +1,120 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "EytzingerProbabilityTable.h"
+
+TEST(EytzingerProbabilityTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
+  // GIVEN a table defined with no weights
+  const auto table_A =
+      game_dice_cpp::EytzingerProbabilityTable::Make(std::span<const int>{});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(EytzingerProbabilityTableTest, MakeWithInvalidWeightsReturnsNullOpt) {
+  // GIVEN tables defined with zero, negative and overflowing weights
+  const auto table_A =
+      game_dice_cpp::EytzingerProbabilityTable::Make(std::to_array({0, 0}));
+  const auto table_B =
+      game_dice_cpp::EytzingerProbabilityTable::Make(std::to_array({-1, -2}));
+  const auto table_C = game_dice_cpp::EytzingerProbabilityTable::Make(
+      std::to_array({std::numeric_limits<int>::max(), 1}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+  EXPECT_FALSE(table_B.has_value());
+  EXPECT_FALSE(table_C.has_value());
+}
+
+TEST(EytzingerProbabilityTableTest,
+     GetOutcomeIndexWithSparsePositiveWeightsReturnsCorrectIndexes) {
+  // GIVEN a table defined with positive weights and zeros
+  const auto table_A =
+      game_dice_cpp::EytzingerProbabilityTable::Make(std::to_array({0, 2, 3}));
+  const auto table_B =
+      game_dice_cpp::EytzingerProbabilityTable::Make(std::to_array({1, 2, 0}));
+  // WHEN GetOutcomeIndex is called
+  // THEN the correct index is returned
+  EXPECT_EQ(table_A->GetTotalWeight(), 5);
+  EXPECT_EQ(table_A->GetOutcomeIndex(-1), 0);
+  EXPECT_EQ(table_A->GetOutcomeIndex(0), 0);
+  EXPECT_EQ(table_A->GetOutcomeIndex(1), 1);
+  EXPECT_EQ(table_A->GetOutcomeIndex(2), 1);
+  EXPECT_EQ(table_A->GetOutcomeIndex(3), 2);
+  EXPECT_EQ(table_A->GetOutcomeIndex(5), 2);  // Table A - bound
+  EXPECT_EQ(table_A->GetOutcomeIndex(6), 2);
+  EXPECT_EQ(table_B->GetTotalWeight(), 3);
+  EXPECT_EQ(table_B->GetOutcomeIndex(1), 0);
+  EXPECT_EQ(table_B->GetOutcomeIndex(3), 1);  // Table B - bound
+  EXPECT_EQ(table_B->GetOutcomeIndex(4), 2);
+}
+
+TEST(EytzingerProbabilityTableTest,
+     GetOutcomeIndexMatchesDynamicProbabilityTableForEveryRoll) {
+  // GIVEN random weight lists of every size up to 200 outcomes
+  std::mt19937 rand_generator(42);
+  std::uniform_int_distribution<int> weight_distribution(-2, 9);
+  for (std::size_t size = 1; size <= 200; ++size) {
+    std::vector<int> weights(size);
+    for (int& weight : weights) {
+      weight = weight_distribution(rand_generator);
+    }
+    weights.back() = 1;
+    // AND the reference table built from the same weights
+    const auto reference = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+    const auto table = game_dice_cpp::EytzingerProbabilityTable::Make(weights);
+    ASSERT_TRUE(reference.has_value());
+    ASSERT_TRUE(table.has_value());
+    ASSERT_EQ(table->GetTotalWeight(), reference->GetTotalWeight());
+    // WHEN every roll around the range of the table is looked up
+    for (int roll = -2; roll <= reference->GetTotalWeight() + 2; ++roll) {
+      // THEN both layouts agree, including the clamped rolls
+      EXPECT_EQ(table->GetOutcomeIndex(roll), reference->GetOutcomeIndex(roll))
+          << "FAILURE: Mismatch for roll " << roll << " with " << size
+          << " outcomes.";
+    }
+  }
+}
+
+TEST(EytzingerProbabilityTableTest,
+     GetTotalWeightWithLargeInputSizeHasCorrectTotalWeight) {
+  // GIVEN a table defined with known weights
+  const std::vector<int> large_weights_list(1'000'000, 1);
+  const auto table_A =
+      game_dice_cpp::EytzingerProbabilityTable::Make(large_weights_list);
+  // WHEN GetTotalWeight is called
+  // THEN it has the correct total weight
+  EXPECT_EQ(table_A->GetTotalWeight(), 1'000'000);
+  EXPECT_EQ(table_A->GetOutcomeIndex(1), 0);
+  EXPECT_EQ(table_A->GetOutcomeIndex(123'457), 123'456);
+  EXPECT_EQ(table_A->GetOutcomeIndex(1'000'000), 999'999);
+}
@@ -0,0 +1,157 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "FenwickProbabilityTable.h"
+
+TEST(FenwickProbabilityTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
+  // GIVEN a table defined with no weights
+  const auto table_A =
+      game_dice_cpp::FenwickProbabilityTable::Make(std::span<const int>{});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(FenwickProbabilityTableTest, MakeWithAllZeroWeightsReturnsNullOpt) {
+  // GIVEN a table defined with zero or negative weights
+  const auto table_A =
+      game_dice_cpp::FenwickProbabilityTable::Make(std::to_array({0, 0, 0}));
+  const auto table_B =
+      game_dice_cpp::FenwickProbabilityTable::Make(std::to_array({-1, -2}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+  EXPECT_FALSE(table_B.has_value());
+}
+
+TEST(FenwickProbabilityTableTest, MakeWithOverflowWeightsDoesNotConstruct) {
+  // GIVEN a table defined with weights that sum past the limit of an int
+  const auto table_A = game_dice_cpp::FenwickProbabilityTable::Make(
+      std::to_array({std::numeric_limits<int>::max(), 1}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(FenwickProbabilityTableTest, GetOutcomeIndexMatchesDynamicTable) {
+  // GIVEN tables of assorted sizes with zero weight outcomes
+  for (const std::size_t size : {1U, 2U, 3U, 5U, 8U, 13U, 64U, 100U}) {
+    std::vector<int> weights(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      weights[i] = static_cast<int>((i * 7) % 5);
+    }
+    weights.front() = 1;
+    const auto fenwick_table =
+        game_dice_cpp::FenwickProbabilityTable::Make(weights);
+    const auto dynamic_table =
+        game_dice_cpp::DynamicProbabilityTable::Make(weights);
+    ASSERT_TRUE(fenwick_table.has_value());
+    ASSERT_TRUE(dynamic_table.has_value());
+    EXPECT_EQ(fenwick_table->GetTotalWeight(), dynamic_table->GetTotalWeight());
+    // WHEN every roll, including out of range rolls, is looked up
+    // THEN the tables agree
+    for (int roll = -2; roll <= dynamic_table->GetTotalWeight() + 2; ++roll) {
+      EXPECT_EQ(fenwick_table->GetOutcomeIndex(roll),
+                dynamic_table->GetOutcomeIndex(roll))
+          << "FAILURE: Mismatch for roll " << roll << " with " << size
+          << " outcomes.";
+    }
+  }
+}
+
+TEST(FenwickProbabilityTableTest, UpdatesMatchRebuildingTheTable) {
+  // GIVEN a table and a copy of its weights
+  std::vector<int> weights(37, 3);
+  auto table_A = game_dice_cpp::FenwickProbabilityTable::Make(weights);
+  ASSERT_TRUE(table_A.has_value());
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<std::size_t> index_distribution(
+      0, weights.size() - 1);
+  std::uniform_int_distribution<int> delta_distribution(-4, 6);
+  // WHEN random updates are applied
+  for (int update = 0; update < 200; ++update) {
+    const std::size_t index = index_distribution(engine);
+    const int delta = delta_distribution(engine);
+    if (update % 2 == 0) {
+      ASSERT_TRUE(table_A->AddWeight(index, delta));
+      weights[index] = std::max(weights[index] + delta, 0);
+    } else {
+      ASSERT_TRUE(table_A->SetWeight(index, delta));
+      weights[index] = std::max(delta, 0);
+    }
+    // THEN the table agrees with a table rebuilt from the new weights
+    const auto rebuilt_table =
+        game_dice_cpp::DynamicProbabilityTable::Make(weights);
+    ASSERT_TRUE(rebuilt_table.has_value());
+    ASSERT_EQ(table_A->GetTotalWeight(), rebuilt_table->GetTotalWeight());
+    EXPECT_EQ(table_A->GetWeight(index), weights[index]);
+    for (int roll = 0; roll <= rebuilt_table->GetTotalWeight() + 1; ++roll) {
+      ASSERT_EQ(table_A->GetOutcomeIndex(roll),
+                rebuilt_table->GetOutcomeIndex(roll))
+          << "FAILURE: Mismatch for roll " << roll << " after update "
+          << update << ".";
+    }
+  }
+}
+
+TEST(FenwickProbabilityTableTest, RejectedUpdatesLeaveTableUnchanged) {
+  // GIVEN a table
+  auto table_A =
+      game_dice_cpp::FenwickProbabilityTable::Make(std::to_array({2, 0, 3}));
+  ASSERT_TRUE(table_A.has_value());
+  // WHEN updates that would overflow, empty the table, or miss it are applied
+  // THEN they are rejected
+  EXPECT_FALSE(table_A->SetWeight(1, std::numeric_limits<int>::max()));
+  EXPECT_FALSE(table_A->AddWeight(2, std::numeric_limits<int>::max()));
+  EXPECT_TRUE(table_A->SetWeight(0, 0));
+  EXPECT_FALSE(table_A->AddWeight(2, -3));
+  EXPECT_FALSE(table_A->SetWeight(3, 1));
+  // AND the table is unchanged by them
+  EXPECT_EQ(table_A->GetTotalWeight(), 3);
+  EXPECT_EQ(table_A->GetWeight(2), 3);
+  EXPECT_EQ(table_A->GetOutcomeIndex(1), 2);
+}
+
+TEST(FenwickProbabilityTableTest, AddWeightThatOverflowsTheWeightIsRejected) {
+  // GIVEN a table with one weight just below the int limit
+  auto table_A = game_dice_cpp::FenwickProbabilityTable::Make(
+      std::to_array({std::numeric_limits<int>::max() - 1, 0}));
+  ASSERT_TRUE(table_A.has_value());
+  // WHEN more is added to it than the int can hold
+  // THEN the update is rejected instead of adding only part of it
+  EXPECT_FALSE(table_A->AddWeight(0, 5));
+  EXPECT_EQ(table_A->GetWeight(0), std::numeric_limits<int>::max() - 1);
+  EXPECT_EQ(table_A->GetTotalWeight(), std::numeric_limits<int>::max() - 1);
+  // AND an update that just fits is applied in full
+  EXPECT_TRUE(table_A->AddWeight(0, 1));
+  EXPECT_EQ(table_A->GetWeight(0), std::numeric_limits<int>::max());
+}
@@ -0,0 +1,66 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+
+#include "FenwickTree.h"
+
+TEST(FenwickTreeTest, FindReturnsWeightHoldingRoll) {
+  // GIVEN a tree with zero weights at both ends and in the middle
+  const auto weights = std::to_array({0, 3, 0, 1, 4, 0, 2, 0});
+  const game_dice_cpp::FenwickTree tree(weights);
+  // WHEN every roll is found
+  // THEN it is held by the first weight whose prefix sum reaches it
+  std::size_t expected = 0;
+  int prefix_sum = 0;
+  for (int roll = 1; roll <= 10; ++roll) {
+    while (prefix_sum + weights[expected] < roll) {
+      prefix_sum += weights[expected];
+      ++expected;
+    }
+    EXPECT_EQ(tree.Find(roll), expected) << "roll " << roll;
+  }
+  // AND rolls past the total return the number of weights
+  EXPECT_EQ(tree.Find(11), weights.size());
+}
+
+TEST(FenwickTreeTest, AddMovesRolls) {
+  // GIVEN a tree of three weights
+  game_dice_cpp::FenwickTree tree(std::to_array({2, 2, 2}));
+  // WHEN the middle weight is removed
+  tree.Add(1, -2);
+  // THEN its rolls move to the next weight
+  EXPECT_EQ(tree.Find(2), 0U);
+  EXPECT_EQ(tree.Find(3), 2U);
+  // WHEN it is put back with more weight
+  tree.Add(1, 5);
+  // THEN it holds its rolls again
+  EXPECT_EQ(tree.Find(3), 1U);
+  EXPECT_EQ(tree.Find(7), 1U);
+  EXPECT_EQ(tree.Find(8), 2U);
+}
@@ -0,0 +1,61 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+// generated from Google_tests/tablec/loot_tables.csv at build time
+#include "loot_tables.h"
+
+TEST(GameDiceTablecTest, GeneratedTablesMatchTheirWeights) {
+  // GIVEN the tables compiled from loot_tables.csv
+  const auto loot_boss = *game_dice_cpp::DynamicProbabilityTable::Make(
+      std::vector<int>{5, 15, 80});
+  // THEN they can be used in constant expressions
+  static_assert(game_tables::loot_common.GetTotalWeight() == 100);
+  static_assert(game_tables::loot_boss.GetTotalWeight() == 100);
+  // AND every roll lands on the same outcome as a table built at run time
+  for (int roll = 1; roll <= 100; ++roll) {
+    EXPECT_EQ(game_tables::loot_boss.GetOutcomeIndex(roll),
+              loot_boss.GetOutcomeIndex(roll));
+  }
+}
+
+TEST(GameDiceTablecTest, SmallestIntWeightCompilesAndCountsAsZero) {
+  // GIVEN a table whose first weight is the smallest int
+  // THEN the generated header compiles and the weight is treated as zero
+  static_assert(game_tables::loot_cursed.GetTotalWeight() == 7);
+  EXPECT_EQ(game_tables::loot_cursed.GetOutcomeIndex(1), 2);
+}
+
+TEST(GameDiceTablecTest, IndexesFollowTheInputOrder) {
+  // GIVEN the tables compiled from loot_tables.csv
+  // THEN each index is the position of its table in the file
+  EXPECT_EQ(game_tables::loot_common_index, 0U);
+  EXPECT_EQ(game_tables::loot_boss_index, 1U);
+  EXPECT_EQ(game_tables::loot_cursed_index, 2U);
+}
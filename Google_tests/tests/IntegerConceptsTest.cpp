@@ -0,0 +1,80 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "Dice.h"
+#include "DynamicProbabilityTable.h"
+#include "IntegerConcepts.h"
+
+namespace {
+// True when BasicDice accepts Sides as its face type.
+template <typename Sides>
+concept DiceAccepts = requires { typename game_dice_cpp::BasicDice<Sides>; };
+
+// True when BasicDynamicProbabilityTable accepts Weight as its weight type.
+template <typename Weight>
+concept TableAccepts = requires {
+  typename game_dice_cpp::BasicDynamicProbabilityTable<Weight>;
+};
+}  // namespace
+
+TEST(IntegerConceptsTest, CountingIntegerAcceptsSizedIntegers) {
+  // GIVEN the signed and unsigned integer types
+  // THEN each one counts
+  EXPECT_TRUE(game_dice_cpp::CountingInteger<int>);
+  EXPECT_TRUE(game_dice_cpp::CountingInteger<const long>);
+  EXPECT_TRUE(game_dice_cpp::CountingInteger<std::int8_t>);
+  EXPECT_TRUE(game_dice_cpp::CountingInteger<std::uint8_t>);
+  EXPECT_TRUE(game_dice_cpp::CountingInteger<std::uint64_t>);
+}
+
+TEST(IntegerConceptsTest, CountingIntegerRejectsBoolAndCharacters) {
+  // GIVEN the integral types that do not hold a count
+  // THEN none of them counts
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<bool>);
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<const bool>);
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<char>);
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<wchar_t>);
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<char8_t>);
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<char16_t>);
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<char32_t>);
+  // AND floating point types are still rejected
+  EXPECT_FALSE(game_dice_cpp::CountingInteger<double>);
+}
+
+TEST(IntegerConceptsTest, DiceAndTablesRejectBoolAndCharacters) {
+  // GIVEN dice and tables templated on their integer type
+  // THEN counting integers are accepted
+  EXPECT_TRUE(DiceAccepts<std::int64_t>);
+  EXPECT_TRUE(TableAccepts<std::int64_t>);
+  // AND bool and char are not
+  EXPECT_FALSE(DiceAccepts<bool>);
+  EXPECT_FALSE(DiceAccepts<char>);
+  EXPECT_FALSE(TableAccepts<bool>);
+  EXPECT_FALSE(TableAccepts<char>);
+}
@@ -0,0 +1,55 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include "Pcg64.h"
+
+TEST(Pcg64Test, MatchesReferenceOutput) {
+  // GIVEN the engine with seed 42 and sequence 54
+  game_dice_cpp::Pcg64 engine(42, 54);
+  // THEN it matches the reference implementation
+  constexpr std::array<std::uint64_t, 6> expected = {
+      0x86b1'da1d'7206'2b68U, 0x1304'aa46'c985'3d39U, 0xa367'0e9e'0dd5'0358U,
+      0xf909'0e52'9a7d'ae00U, 0xc85b'9fd8'3799'6f2cU, 0x6061'21f8'e391'9196U};
+  for (const std::uint64_t value : expected) {
+    EXPECT_EQ(engine(), value);
+  }
+}
+
+TEST(Pcg64Test, SequencesAreIndependent) {
+  // GIVEN two engines with the same seed and different sequences
+  game_dice_cpp::Pcg64 engine_a(42, 1);
+  game_dice_cpp::Pcg64 engine_b(42, 2);
+  // THEN they produce different values
+  int matches = 0;
+  for (int trial = 0; trial < 100; ++trial) {
+    matches += engine_a() == engine_b() ? 1 : 0;
+  }
+  EXPECT_EQ(matches, 0);
+}
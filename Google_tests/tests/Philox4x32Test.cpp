@@ -0,0 +1,118 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Philox4x32.h"
+
+using Counter = game_dice_cpp::Philox4x32::Counter;
+using Key = game_dice_cpp::Philox4x32::Key;
+
+TEST(Philox4x32Test, BlockMatchesKnownAnswers) {
+  // GIVEN the known answer vectors of the reference implementation
+  // THEN every block matches at compile time
+  static_assert(game_dice_cpp::Philox4x32::Block({0, 0, 0, 0}, {0, 0}) ==
+                Counter{0x6627'e8d5U, 0xe169'c58dU, 0xbc57'ac4cU,
+                        0x9b00'dbd8U});
+  static_assert(
+      game_dice_cpp::Philox4x32::Block(
+          {0xffff'ffffU, 0xffff'ffffU, 0xffff'ffffU, 0xffff'ffffU},
+          {0xffff'ffffU, 0xffff'ffffU}) ==
+      Counter{0x408f'276dU, 0x41c8'3b0eU, 0xa20b'c7c6U, 0x6d54'51fdU});
+  static_assert(
+      game_dice_cpp::Philox4x32::Block(
+          {0x243f'6a88U, 0x85a3'08d3U, 0x1319'8a2eU, 0x0370'7344U},
+          {0xa409'3822U, 0x299f'31d0U}) ==
+      Counter{0xd16c'fe09U, 0x94fd'ccebU, 0x5001'e420U, 0x2412'6ea1U});
+}
+
+TEST(Philox4x32Test, StreamIsBlocksInOrder) {
+  // GIVEN an engine seeded with 42
+  game_dice_cpp::Philox4x32 engine(42);
+  // WHEN values are drawn
+  // THEN they are the blocks of counters 0, 1, 2... under the key {42, 0}
+  for (std::uint32_t block = 0; block < 3; ++block) {
+    const Counter expected =
+        game_dice_cpp::Philox4x32::Block({block, 0, 0, 0}, {42, 0});
+    for (const std::uint32_t value : expected) {
+      EXPECT_EQ(engine(), value);
+    }
+  }
+}
+
+TEST(Philox4x32Test, SeekMatchesDrawing) {
+  // GIVEN a sequence of values drawn one at a time
+  game_dice_cpp::Philox4x32 reference(7, 3);
+  std::vector<std::uint32_t> expected(64);
+  for (std::uint32_t& value : expected) {
+    value = reference();
+  }
+  for (std::uint64_t position = 0; position < expected.size(); ++position) {
+    // WHEN a fresh engine seeks to a position
+    game_dice_cpp::Philox4x32 engine(7, 3);
+    engine.Seek(position);
+    // THEN it reports that position and continues the sequence from there
+    EXPECT_EQ(engine.GetPosition(), position);
+    EXPECT_EQ(engine(), expected[position]);
+    EXPECT_EQ(engine.GetPosition(), position + 1);
+  }
+}
+
+TEST(Philox4x32Test, GenerateBlockMatchesDrawing) {
+  for (std::size_t offset = 0; offset < 5; ++offset) {
+    for (const std::size_t length : {0U, 1U, 3U, 31U, 32U, 33U, 100U}) {
+      // GIVEN two engines at the same position
+      game_dice_cpp::Philox4x32 engine_a(42, 1);
+      game_dice_cpp::Philox4x32 engine_b(42, 1);
+      engine_a.discard(offset);
+      engine_b.discard(offset);
+      // WHEN one fills a buffer and the other draws one value at a time
+      std::vector<std::uint32_t> values(length);
+      engine_a.GenerateBlock(values);
+      // THEN the values and the final states are the same
+      for (const std::uint32_t value : values) {
+        ASSERT_EQ(value, engine_b());
+      }
+      EXPECT_EQ(engine_a, engine_b);
+      EXPECT_EQ(engine_a(), engine_b());
+    }
+  }
+}
+
+TEST(Philox4x32Test, StreamsAreIndependent) {
+  // GIVEN two engines with the same seed and different streams
+  game_dice_cpp::Philox4x32 engine_a(42, 1);
+  game_dice_cpp::Philox4x32 engine_b(42, 2);
+  // THEN they produce different values
+  int matches = 0;
+  for (int trial = 0; trial < 100; ++trial) {
+    matches += engine_a() == engine_b() ? 1 : 0;
+  }
+  EXPECT_LT(matches, 2);
+}
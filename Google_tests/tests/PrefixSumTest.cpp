@@ -0,0 +1,194 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "PrefixSum.h"
+
+namespace {
+// The scan written the obvious way, with a check on every step.
+std::optional<int> ReferencePrefixSum(const std::vector<int>& weights,
+                                      std::vector<int>& thresholds) {
+  std::int64_t total_weight = 0;
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    total_weight += std::max(weights[i], 0);
+    if (total_weight > std::numeric_limits<int>::max()) {
+      return std::nullopt;
+    }
+    thresholds[i] = static_cast<int>(total_weight);
+  }
+  return static_cast<int>(total_weight);
+}
+}  // namespace
+
+TEST(PrefixSumTest, MatchesReferenceForEverySize) {
+  // GIVEN random weights, including negatives, at sizes around every
+  // vector width
+  auto engine = std::mt19937(42);
+  std::uniform_int_distribution<int> distribution(-50, 1000);
+  for (std::size_t size = 0; size <= 70; ++size) {
+    std::vector<int> weights(size);
+    for (int& weight : weights) {
+      weight = distribution(engine);
+    }
+    // WHEN the weights are scanned
+    std::vector<int> expected(size);
+    std::vector<int> actual(size);
+    const auto expected_total = ReferencePrefixSum(weights, expected);
+    const auto actual_total =
+        game_dice_cpp::ClampedPrefixSum<int>(weights, actual);
+    // THEN the totals and every threshold match
+    EXPECT_EQ(actual_total, expected_total) << "size " << size;
+    EXPECT_EQ(actual, expected) << "size " << size;
+  }
+}
+
+TEST(PrefixSumTest, DetectsOverflowAtEveryPosition) {
+  // GIVEN weights that sum to exactly the limit, and to one past it, with
+  // the last unit of weight at every position
+  constexpr int max_weight = std::numeric_limits<int>::max();
+  for (std::size_t size = 1; size <= 20; ++size) {
+    for (std::size_t position = 0; position < size; ++position) {
+      std::vector<int> weights(size, 0);
+      const std::size_t large_position = size - 1 - position;
+      // a single weight holds the whole limit when the positions meet
+      if (large_position == position) {
+        weights[position] = max_weight;
+      } else {
+        weights[large_position] = max_weight - 1;
+        weights[position] = 1;
+      }
+      std::vector<int> thresholds(size);
+      // WHEN the weights are scanned
+      // THEN the limit is accepted
+      EXPECT_EQ(game_dice_cpp::ClampedPrefixSum<int>(weights, thresholds),
+                max_weight);
+      // a single int cannot hold more than the limit
+      if (size == 1) {
+        continue;
+      }
+      // THEN one past the limit is rejected
+      if (large_position == position) {
+        weights[(position + 1) % size] = 1;
+      } else {
+        weights[position] = 2;
+      }
+      EXPECT_FALSE(game_dice_cpp::ClampedPrefixSum<int>(weights, thresholds))
+          << "size " << size << " position " << position;
+    }
+  }
+}
+
+TEST(PrefixSumTest, DetectsOverflowThatWrapsBackToPositive) {
+  // GIVEN a block of maximum weights, whose 32-bit sum wraps past zero
+  const std::vector<int> weights(16, std::numeric_limits<int>::max());
+  std::vector<int> thresholds(weights.size());
+  // WHEN the weights are scanned
+  // THEN the overflow is detected
+  EXPECT_FALSE(game_dice_cpp::ClampedPrefixSum<int>(weights, thresholds));
+}
+
+TEST(PrefixSumTest, ConstantEvaluationMatchesRuntime) {
+  // GIVEN weights scanned at compile time
+  constexpr auto weights = std::to_array({4, -1, 0, 7, 2, 9, 1, 3, 5});
+  constexpr auto compile_time = [] {
+    std::array<int, 9> thresholds{};
+    const auto total = game_dice_cpp::ClampedPrefixSum<int>(
+        std::to_array({4, -1, 0, 7, 2, 9, 1, 3, 5}), thresholds);
+    return std::pair(total, thresholds);
+  }();
+  // WHEN the same weights are scanned at run time
+  std::array<int, 9> thresholds{};
+  const auto total = game_dice_cpp::ClampedPrefixSum<int>(weights, thresholds);
+  // THEN both scans agree
+  EXPECT_EQ(total, compile_time.first);
+  EXPECT_EQ(thresholds, compile_time.second);
+}
+
+TEST(PrefixSumTest, ParallelScanMatchesSerialScan) {
+  // GIVEN random weights, including negatives, large enough to be split
+  auto engine = std::mt19937(7);
+  std::uniform_int_distribution<int> distribution(-50, 1000);
+  std::vector<int> weights((std::size_t{1} << 18) + 13);
+  for (int& weight : weights) {
+    weight = distribution(engine);
+  }
+  std::vector<int> expected(weights.size());
+  const auto expected_total =
+      game_dice_cpp::ClampedPrefixSum<int>(weights, expected);
+  for (const std::size_t threads : {0U, 1U, 2U, 3U, 4U, 16U}) {
+    // WHEN the weights are scanned on several threads
+    std::vector<int> actual(weights.size());
+    const auto actual_total =
+        game_dice_cpp::ParallelClampedPrefixSum<int>(weights, actual, threads);
+    // THEN the total and every threshold are identical
+    EXPECT_EQ(actual_total, expected_total) << threads << " threads";
+    EXPECT_EQ(actual, expected) << threads << " threads";
+  }
+}
+
+TEST(PrefixSumTest, ParallelScanDetectsOverflowAcrossChunks) {
+  // GIVEN weights where every chunk fits in an int but the total does not
+  std::vector<int> weights(std::size_t{1} << 18, 0);
+  weights.front() = std::numeric_limits<int>::max() / 2;
+  weights.back() = std::numeric_limits<int>::max() / 2 + 2;
+  std::vector<int> thresholds(weights.size());
+  // WHEN the weights are scanned on several threads
+  // THEN the overflow is detected
+  EXPECT_FALSE(
+      game_dice_cpp::ParallelClampedPrefixSum<int>(weights, thresholds, 4));
+  // THEN one less than the overflow is accepted
+  weights.back() -= 1;
+  EXPECT_EQ(
+      game_dice_cpp::ParallelClampedPrefixSum<int>(weights, thresholds, 4),
+      std::numeric_limits<int>::max());
+}
+
+TEST(PrefixSumTest, ClampedSumMatchesPrefixSum) {
+  // GIVEN weights that fit, weights that overflow and wide weights
+  const std::vector<int> fits = {5, -3, 0, std::numeric_limits<int>::max() - 5};
+  const std::vector<int> overflows = {std::numeric_limits<int>::max(), -7, 1};
+  const std::vector<std::uint64_t> wide = {
+      std::numeric_limits<std::uint64_t>::max() - 1, 1};
+  // WHEN the weights are summed
+  // THEN the totals match the prefix sum
+  std::vector<int> thresholds(4);
+  EXPECT_EQ(game_dice_cpp::ClampedSum<int>(fits),
+            game_dice_cpp::ClampedPrefixSum<int>(fits, thresholds));
+  EXPECT_FALSE(game_dice_cpp::ClampedSum<int>(overflows).has_value());
+  EXPECT_EQ(game_dice_cpp::ClampedSum<std::uint64_t>(wide),
+            std::numeric_limits<std::uint64_t>::max());
+  EXPECT_EQ(game_dice_cpp::ClampedSum<int>(std::span<const int>{}), 0);
+}
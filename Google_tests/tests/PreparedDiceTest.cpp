@@ -0,0 +1,52 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "Dice.h"
+#include "PreparedDice.h"
+
+TEST(PreparedDiceTest, KeepsDieGeometry) {
+  // GIVEN a d20
+  constexpr auto d20 = game_dice_cpp::Dice(20);
+  // WHEN it is prepared
+  constexpr auto prepared = game_dice_cpp::PreparedDice(d20);
+  // THEN it has the same number of sides
+  static_assert(prepared.GetNumSides() == 20);
+  static_assert(prepared.GetDice().GetNumSides() == 20);
+  // AND its generator chooses among 20 faces
+  static_assert(prepared.GetGenerator().GetRange() == 20U);
+}
+
+TEST(PreparedDiceTest, WideDieUsesWideGenerator) {
+  // GIVEN a die with more sides than 32 bits can hold
+  constexpr auto dice = game_dice_cpp::BasicDice<std::uint64_t>(10'000'000'000);
+  // WHEN it is prepared
+  constexpr auto prepared = game_dice_cpp::BasicPreparedDice(dice);
+  // THEN its generator chooses among every face
+  static_assert(prepared.GetGenerator().GetRange() == 10'000'000'000U);
+}
@@ -0,0 +1,87 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "Actions.h"
+#include "Pcg32.h"
+#include "Pcg64.h"
+#include "Philox4x32.h"
+#include "SplitMix64.h"
+#include "WyRand.h"
+#include "Xoshiro256StarStar.h"
+
+// The behaviour every engine shares. Each engine checks its reference output
+// in its own test file.
+template <typename Engine>
+class RandomEnginesTest : public testing::Test {};
+
+using Engines =
+    testing::Types<game_dice_cpp::SplitMix64, game_dice_cpp::WyRand,
+                   game_dice_cpp::Xoshiro256StarStar, game_dice_cpp::Pcg32,
+                   game_dice_cpp::Pcg64, game_dice_cpp::Philox4x32>;
+TYPED_TEST_SUITE(RandomEnginesTest, Engines);
+
+TYPED_TEST(RandomEnginesTest, SatisfiesUniformRandomBitGenerator) {
+  // GIVEN the engine type
+  // THEN it can drive the standard library and Roll
+  static_assert(std::uniform_random_bit_generator<TypeParam>);
+  TypeParam engine(42);
+  const auto d20 = game_dice_cpp::Dice(20);
+  for (int trial = 0; trial < 1'000; ++trial) {
+    const int result = game_dice_cpp::Roll(d20, engine);
+    EXPECT_GE(result, 1);
+    EXPECT_LE(result, 20);
+  }
+}
+
+TYPED_TEST(RandomEnginesTest, DiscardMatchesDrawing) {
+  // GIVEN two engines with the same seed
+  TypeParam engine_a(42);
+  TypeParam engine_b(42);
+  // WHEN one draws values and the other discards the same number, which is
+  // not a multiple of any block size
+  for (int trial = 0; trial < 1'001; ++trial) {
+    static_cast<void>(engine_a());
+  }
+  engine_b.discard(1'001);
+  // THEN they are in the same state
+  EXPECT_EQ(engine_a, engine_b);
+  EXPECT_EQ(engine_a(), engine_b());
+}
+
+TYPED_TEST(RandomEnginesTest, SeedRestartsStream) {
+  // GIVEN an engine that has drawn some values
+  TypeParam engine(42);
+  const auto first = engine();
+  static_cast<void>(engine());
+  // WHEN it is seeded again with the same seed
+  engine.seed(42);
+  // THEN it repeats the stream
+  EXPECT_EQ(engine(), first);
+  EXPECT_NE(TypeParam(42), TypeParam(43));
+}
@@ -0,0 +1,116 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "StaticAliasTable.h"
+
+TEST(StaticAliasTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
+  // GIVEN a table defined with no weights
+  // WHEN Make is called
+  // THEN there is nothing returned
+  const auto table_A = game_dice_cpp::StaticAliasTable<0>::Make({});
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(StaticAliasTableTest, MakeWithAllZeroWeightsReturnsNullOpt) {
+  // GIVEN a table defined with zero weights
+  // WHEN Make is called
+  // THEN there is nothing returned
+  const auto table_A = game_dice_cpp::StaticAliasTable<1>::Make({0});
+  const auto table_B = game_dice_cpp::StaticAliasTable<3>::Make({0, 0, 0});
+  EXPECT_FALSE(table_A.has_value());
+  EXPECT_FALSE(table_B.has_value());
+}
+
+TEST(StaticAliasTableTest, MakeWithOverflowWeightsDoesNotConstruct) {
+  // GIVEN a table defined with weights that sum past the limit of an int
+  const auto table_A = game_dice_cpp::StaticAliasTable<4>::Make(
+      {std::numeric_limits<int>::max(), std::numeric_limits<int>::max(),
+       std::numeric_limits<int>::max(), -1230});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(StaticAliasTableTest, MakeIsEvaluatedAtCompileTime) {
+  // GIVEN a table built in a constant expression
+  constexpr auto table_A =
+      game_dice_cpp::StaticAliasTable<4>::Make({80, 15, 4, 1}).value();
+  // THEN its queries are also available at compile time
+  static_assert(table_A.GetTotalWeight() == 100);
+  static_assert(table_A.GetRollRange() == 400);
+  static_assert(table_A.GetOutcomeIndex(1) == 0);
+  EXPECT_EQ(table_A.GetTotalWeight(), 100);
+}
+
+TEST(StaticAliasTableTest, GetOutcomeIndexCoversEveryRollExactlyByWeight) {
+  // GIVEN a table defined with assorted weights
+  constexpr std::array<int, 8> weights = {8, 7, 8, 3, 2, 1, 9, 4};
+  constexpr auto table_A =
+      game_dice_cpp::StaticAliasTable<8>::Make(weights).value();
+  // WHEN every roll in the range is mapped to an outcome
+  std::array<std::uint64_t, 8> counts{};
+  for (std::uint64_t roll = 1; roll <= table_A.GetRollRange(); ++roll) {
+    counts.at(static_cast<std::size_t>(table_A.GetOutcomeIndex(roll)))++;
+  }
+  // THEN each outcome owns exactly weight * number_of_outcomes rolls
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    EXPECT_EQ(counts.at(i), static_cast<std::uint64_t>(weights.at(i)) * 8)
+        << "FAILURE: Outcome " << i << " has the wrong share of rolls.";
+  }
+}
+
+TEST(StaticAliasTableTest, GetOutcomeIndexWithSparseWeightsNeverSelectsZero) {
+  // GIVEN a table defined with positive weights, zeros and negatives
+  constexpr auto table_A =
+      game_dice_cpp::StaticAliasTable<5>::Make({0, 3, -2, 1, 0}).value();
+  // WHEN every roll in the range is mapped to an outcome
+  for (std::uint64_t roll = 1; roll <= table_A.GetRollRange(); ++roll) {
+    const int outcome = table_A.GetOutcomeIndex(roll);
+    // THEN only outcomes with a positive weight are selected
+    EXPECT_TRUE(outcome == 1 || outcome == 3)
+        << "FAILURE: Roll " << roll << " selected outcome " << outcome << ".";
+  }
+}
+
+TEST(StaticAliasTableTest, SampleSameSeedReturnsDeterministicResult) {
+  // GIVEN a table defined with known weights
+  constexpr auto table_A =
+      game_dice_cpp::StaticAliasTable<4>::Make({5, 0, 3, 2}).value();
+  // AND two random number generators with the same seed
+  std::mt19937_64 rand_generator_a(42);
+  std::mt19937_64 rand_generator_b(42);
+  for (int trial = 0; trial < 1'000; trial++) {
+    // WHEN the table is sampled
+    // THEN the results are the same
+    EXPECT_EQ(table_A.Sample(rand_generator_a),
+              table_A.Sample(rand_generator_b));
+  }
+}
@@ -25,6 +25,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
 #include "StaticProbabilityTable.h"
 
 TEST(StaticProbabilityTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
@@ -485,4 +491,194 @@ TEST(StaticProbabilityTableTest,
   // WHEN At is called
   // THEN it has the correct total weight
   EXPECT_EQ(table_A->GetTotalWeight(), 220);
-}
\ No newline at end of file
+}
+
+// Looks up every roll in [-2, 61] so the results can be computed in a
+// constant expression.
+template <std::size_t N>
+constexpr std::array<int, 64> LookUpSmallRolls(
+    const game_dice_cpp::StaticProbabilityTable<N>& table) {
+  std::array<int, 64> outcomes{};
+  for (std::size_t i = 0; i < outcomes.size(); ++i) {
+    outcomes.at(i) = table.GetOutcomeIndex(static_cast<int>(i) - 2);
+  }
+  return outcomes;
+}
+
+TEST(StaticProbabilityTableTest,
+     GetOutcomeIndexAtRunTimeMatchesCompileTimeForSmallTables) {
+  // GIVEN small tables of sizes that exercise full and partial SIMD blocks
+  constexpr auto table_A = *game_dice_cpp::StaticProbabilityTable<1>::Make({3});
+  constexpr auto table_B =
+      *game_dice_cpp::StaticProbabilityTable<4>::Make({0, 2, 3, 1});
+  constexpr auto table_C =
+      *game_dice_cpp::StaticProbabilityTable<7>::Make({1, 0, 3, 2, 0, 5, 0});
+  constexpr auto table_D =
+      *game_dice_cpp::StaticProbabilityTable<8>::Make({8, 7, 8, 3, 2, 1, 9, 4});
+  constexpr auto table_E = *game_dice_cpp::StaticProbabilityTable<13>::Make(
+      {1, 2, 3, 4, 0, 2, 1, 3, 4, 2, 5, 1, 2});
+  constexpr auto table_F = *game_dice_cpp::StaticProbabilityTable<16>::Make(
+      {1, 9, 5, 6, 8, 7, 3, 1, 9, 8, 2, 2, 6, 3, 7, 8});
+  // AND the outcomes computed by the compile-time (scalar) path
+  constexpr auto expected_A = LookUpSmallRolls(table_A);
+  constexpr auto expected_B = LookUpSmallRolls(table_B);
+  constexpr auto expected_C = LookUpSmallRolls(table_C);
+  constexpr auto expected_D = LookUpSmallRolls(table_D);
+  constexpr auto expected_E = LookUpSmallRolls(table_E);
+  constexpr auto expected_F = LookUpSmallRolls(table_F);
+  // WHEN the same rolls are looked up at run time (vectorized path)
+  // THEN the outcomes are identical
+  EXPECT_EQ(LookUpSmallRolls(table_A), expected_A);
+  EXPECT_EQ(LookUpSmallRolls(table_B), expected_B);
+  EXPECT_EQ(LookUpSmallRolls(table_C), expected_C);
+  EXPECT_EQ(LookUpSmallRolls(table_D), expected_D);
+  EXPECT_EQ(LookUpSmallRolls(table_E), expected_E);
+  EXPECT_EQ(LookUpSmallRolls(table_F), expected_F);
+}
+
+TEST(StaticProbabilityTableTest,
+     GetOutcomeIndexesMatchesGetOutcomeIndexForEveryRoll) {
+  // GIVEN a small (linear search) and a large (binary search) table
+  constexpr auto table_A =
+      *game_dice_cpp::StaticProbabilityTable<8>::Make({8, 7, 8, 3, 2, 1, 9, 4});
+  constexpr auto table_B = *game_dice_cpp::StaticProbabilityTable<32>::Make(
+      {1, 8, 3, 2, 5, 2, 2, 6, 3, 7, 8, 6, 5, 2, 1, 2,
+       8, 3, 0, 5, 3, 2, 5, 8, 5, 4, 8, 2, 1, 8, 1, 9});
+  // AND a batch of rolls that covers and exceeds both tables
+  std::array<int, 155> rolls{};
+  for (std::size_t i = 0; i < rolls.size(); ++i) {
+    rolls.at(i) = static_cast<int>(i) - 2;
+  }
+  // WHEN the batch is mapped in one call
+  std::array<int, 155> out_indexes_A{};
+  std::array<int, 155> out_indexes_B{};
+  table_A.GetOutcomeIndexes(rolls, out_indexes_A);
+  table_B.GetOutcomeIndexes(rolls, out_indexes_B);
+  // THEN every result matches a single lookup
+  for (std::size_t i = 0; i < rolls.size(); ++i) {
+    EXPECT_EQ(out_indexes_A.at(i), table_A.GetOutcomeIndex(rolls.at(i)));
+    EXPECT_EQ(out_indexes_B.at(i), table_B.GetOutcomeIndex(rolls.at(i)));
+  }
+}
+
+TEST(StaticProbabilityTableTest, DenseLookupMatchesSearchForEveryRoll) {
+  // GIVEN percent-style weights with zero weight outcomes at both ends
+  constexpr std::array<int, 8> weights{0, 10, 25, 0, 40, 20, 5, 0};
+  // WHEN one table uses a dense lookup and another searches
+  constexpr auto dense_table =
+      *game_dice_cpp::StaticProbabilityTable<8, 100>::Make(weights);
+  constexpr auto search_table =
+      *game_dice_cpp::StaticProbabilityTable<8>::Make(weights);
+  // THEN the dense lookup also works at compile time
+  static_assert(dense_table.GetOutcomeIndex(11) == 2);
+  static_assert(dense_table.GetOutcomeIndex(101) == 7);
+  // AND every roll, including out of range rolls, maps to the same outcome
+  for (int roll = -5; roll <= 105; ++roll) {
+    EXPECT_EQ(dense_table.GetOutcomeIndex(roll),
+              search_table.GetOutcomeIndex(roll))
+        << "FAILURE: Mismatch for roll " << roll << ".";
+  }
+}
+
+TEST(StaticProbabilityTableTest, DenseLookupFallsBackAboveBound) {
+  // GIVEN a large table whose total weight is above the dense bound
+  std::array<int, 40> weights{};
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights.at(i) = static_cast<int>(i % 5);
+  }
+  const auto bounded_table =
+      game_dice_cpp::StaticProbabilityTable<40, 50>::Make(weights);
+  const auto search_table =
+      game_dice_cpp::StaticProbabilityTable<40>::Make(weights);
+  ASSERT_TRUE(bounded_table.has_value());
+  ASSERT_TRUE(search_table.has_value());
+  // WHEN every roll is looked up one at a time and as a batch
+  std::array<int, 90> rolls{};
+  for (std::size_t i = 0; i < rolls.size(); ++i) {
+    rolls.at(i) = static_cast<int>(i) - 2;
+  }
+  std::array<int, 90> out_indexes{};
+  bounded_table->GetOutcomeIndexes(rolls, out_indexes);
+  // THEN the results match the search
+  for (std::size_t i = 0; i < rolls.size(); ++i) {
+    EXPECT_EQ(bounded_table->GetOutcomeIndex(rolls.at(i)),
+              search_table->GetOutcomeIndex(rolls.at(i)));
+    EXPECT_EQ(out_indexes.at(i), search_table->GetOutcomeIndex(rolls.at(i)));
+  }
+}
+
+TEST(StaticProbabilityTableTest, SampleDistinctReturnsDistinctWeightedOutcomes) {
+  // GIVEN a table with a zero weight outcome
+  constexpr auto table_A =
+      *game_dice_cpp::StaticProbabilityTable<5>::Make({2, 0, 7, 1, 5});
+  auto engine = std::mt19937(42);
+  // WHEN every outcome with weight is sampled
+  std::vector<int> sample = table_A.SampleDistinct(4, engine);
+  // THEN each of them appears once
+  std::ranges::sort(sample);
+  EXPECT_EQ(sample, std::vector<int>({0, 2, 3, 4}));
+}
+
+TEST(StaticProbabilityTableTest, Uint64WeightsHoldTotalsPastIntMax) {
+  // GIVEN small and large tables whose totals do not fit in an int
+  constexpr auto table_A =
+      *game_dice_cpp::BasicStaticProbabilityTable<std::uint64_t, 3>::Make(
+          {5'000'000'000, 0, 5'000'000'000});
+  std::array<std::uint64_t, 20> wide_weights{};
+  wide_weights.fill(1'000'000'000);
+  const auto table_B =
+      game_dice_cpp::BasicStaticProbabilityTable<std::uint64_t, 20>::Make(
+          wide_weights);
+  ASSERT_TRUE(table_B.has_value());
+  // WHEN rolls at the edges of the outcomes are looked up
+  // THEN they map to the correct outcome, at compile time as well
+  static_assert(table_A.GetTotalWeight() == 10'000'000'000);
+  static_assert(table_A.GetOutcomeIndex(5'000'000'000) == 0);
+  static_assert(table_A.GetOutcomeIndex(5'000'000'001) == 2);
+  EXPECT_EQ(table_A.GetOutcomeIndex(5'000'000'001), 2);
+  EXPECT_EQ(table_B->GetOutcomeIndex(3'000'000'000), 2);
+  EXPECT_EQ(table_B->GetOutcomeIndex(3'000'000'001), 3);
+  EXPECT_EQ(table_B->GetOutcomeIndex(30'000'000'000), 19);
+}
+
+TEST(StaticProbabilityTableTest, NarrowWeightsWorkWithAndWithoutDenseLookup) {
+  // GIVEN 8-bit and 16-bit tables whose totals are the type's maximum
+  constexpr auto table_A =
+      *game_dice_cpp::BasicStaticProbabilityTable<std::int8_t, 2>::Make(
+          {100, 27});
+  constexpr auto table_B =
+      *game_dice_cpp::BasicStaticProbabilityTable<std::int8_t, 2, 127>::Make(
+          {100, 27});
+  constexpr auto table_C =
+      *game_dice_cpp::BasicStaticProbabilityTable<std::uint8_t, 3, 255>::Make(
+          {200, 0, 55});
+  const auto table_D =
+      game_dice_cpp::BasicStaticProbabilityTable<std::int16_t, 2, 32'767>::
+          Make({32'000, 767});
+  ASSERT_TRUE(table_D.has_value());
+  // WHEN rolls at the edges of each outcome and past the total are looked up
+  // THEN they map to the correct outcome
+  static_assert(table_A.GetOutcomeIndex(100) == 0);
+  static_assert(table_A.GetOutcomeIndex(127) == 1);
+  static_assert(table_B.GetOutcomeIndex(-128) == 0);
+  static_assert(table_B.GetOutcomeIndex(100) == 0);
+  static_assert(table_B.GetOutcomeIndex(101) == 1);
+  static_assert(table_B.GetOutcomeIndex(127) == 1);
+  static_assert(table_C.GetOutcomeIndex(0) == 0);
+  static_assert(table_C.GetOutcomeIndex(201) == 2);
+  static_assert(table_C.GetOutcomeIndex(255) == 2);
+  EXPECT_EQ(table_B.GetOutcomeIndex(101), 1);
+  EXPECT_EQ(table_D->GetOutcomeIndex(32'000), 0);
+  EXPECT_EQ(table_D->GetOutcomeIndex(32'001), 1);
+  EXPECT_EQ(table_D->GetOutcomeIndex(32'767), 1);
+}
+
+TEST(StaticProbabilityTableTest, Uint64WeightsThatOverflowDoNotConstruct) {
+  // GIVEN weights that sum past the limit of a uint64_t
+  constexpr auto table_A =
+      game_dice_cpp::BasicStaticProbabilityTable<std::uint64_t, 2>::Make(
+          {std::numeric_limits<std::uint64_t>::max(), 1});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
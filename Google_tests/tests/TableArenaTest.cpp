@@ -0,0 +1,149 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <forward_list>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "TableArena.h"
+
+TEST(TableArenaTest, MakeWithNoTablesIsEmpty) {
+  // GIVEN no weight lists
+  const std::vector<std::vector<int>> tables;
+  // WHEN Make is called
+  const auto arena = game_dice_cpp::TableArena::Make(tables);
+  // THEN an empty arena is returned
+  ASSERT_TRUE(arena.has_value());
+  EXPECT_EQ(arena->GetNumberOfTables(), 0U);
+}
+
+TEST(TableArenaTest, MakeWithAnyInvalidTableReturnsNullOpt) {
+  // GIVEN weight lists where one is empty, all zero or overflows
+  const std::vector<std::vector<int>> tables_A = {{1, 2}, {}};
+  const std::vector<std::vector<int>> tables_B = {{0, -1}, {1, 2}};
+  const std::vector<std::vector<int>> tables_C = {
+      {1}, {std::numeric_limits<int>::max(), 1}};
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(game_dice_cpp::TableArena::Make(tables_A).has_value());
+  EXPECT_FALSE(game_dice_cpp::TableArena::Make(tables_B).has_value());
+  EXPECT_FALSE(game_dice_cpp::TableArena::Make(tables_C).has_value());
+}
+
+TEST(TableArenaTest, MakeAcceptsSpansOfSpans) {
+  // GIVEN weights owned elsewhere and viewed through spans
+  const auto weights_A = std::to_array({1, 1});
+  const auto weights_B = std::to_array({5, 0, 5});
+  const std::array<std::span<const int>, 2> tables = {weights_A, weights_B};
+  // WHEN Make is called
+  const auto arena = game_dice_cpp::TableArena::Make(tables);
+  // THEN both tables are stored with their total weights
+  ASSERT_TRUE(arena.has_value());
+  ASSERT_EQ(arena->GetNumberOfTables(), 2U);
+  EXPECT_EQ(arena->GetTable(0).GetTotalWeight(), 2);
+  EXPECT_EQ(arena->GetTable(1).GetTotalWeight(), 10);
+}
+
+TEST(TableArenaTest, MakeReadsEachWeightOnce) {
+  // GIVEN weight lists that count every read
+  const std::vector<int> weights_A = {1, 2, 3};
+  const std::vector<int> weights_B = {4, 0};
+  int reads = 0;
+  const auto count_read = [&reads](int weight) {
+    ++reads;
+    return weight;
+  };
+  const std::vector tables = {std::views::transform(weights_A, count_read),
+                              std::views::transform(weights_B, count_read)};
+  // WHEN Make is called
+  const auto arena = game_dice_cpp::TableArena::Make(tables);
+  // THEN the tables are stored
+  ASSERT_TRUE(arena.has_value());
+  EXPECT_EQ(arena->GetTable(0).GetTotalWeight(), 6);
+  EXPECT_EQ(arena->GetTable(1).GetTotalWeight(), 4);
+  // AND each weight was validated and stored in a single read
+  EXPECT_EQ(reads, 5);
+}
+
+TEST(TableArenaTest, MakeAcceptsUnsizedWeightLists) {
+  // GIVEN weight lists that do not know their size
+  const std::vector<std::forward_list<int>> tables = {{1, 1}, {2, 0, 2}};
+  // WHEN Make is called
+  const auto arena = game_dice_cpp::TableArena::Make(tables);
+  // THEN both tables are stored
+  ASSERT_TRUE(arena.has_value());
+  ASSERT_EQ(arena->GetNumberOfTables(), 2U);
+  EXPECT_EQ(arena->GetTable(1).GetTotalWeight(), 4);
+}
+
+TEST(TableArenaTest, ViewsMatchDynamicTables) {
+  // GIVEN many tables of assorted sizes with zero and negative weights
+  std::vector<std::vector<int>> tables;
+  for (std::size_t size = 1; size <= 40; ++size) {
+    std::vector<int> weights(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      weights[i] = static_cast<int>((i * 7 + size) % 6) - 1;
+    }
+    weights.back() = 3;
+    tables.push_back(weights);
+  }
+  // WHEN the tables are built into an arena
+  const auto arena = game_dice_cpp::TableArena::Make(tables);
+  ASSERT_TRUE(arena.has_value());
+  ASSERT_EQ(arena->GetNumberOfTables(), tables.size());
+  // THEN every view agrees with a DynamicProbabilityTable for every roll,
+  // including out of range rolls
+  for (std::size_t t = 0; t < tables.size(); ++t) {
+    const auto expected = game_dice_cpp::DynamicProbabilityTable::Make(
+        tables[t], {.dense_lookup_max_weight = 0});
+    ASSERT_TRUE(expected.has_value());
+    const auto view = arena->GetTable(t);
+    EXPECT_EQ(view.GetTotalWeight(), expected->GetTotalWeight());
+    for (int roll = -1; roll <= expected->GetTotalWeight() + 1; ++roll) {
+      EXPECT_EQ(view.GetOutcomeIndex(roll), expected->GetOutcomeIndex(roll));
+    }
+  }
+}
+
+TEST(TableArenaTest, ArenaUsesLessMemoryThanTheSumOfItsTables) {
+  // GIVEN a thousand small tables
+  std::vector<std::vector<int>> tables(1000, std::vector<int>{1, 2, 3, 4});
+  // WHEN the tables are built into an arena
+  const auto arena = game_dice_cpp::TableArena::Make(tables);
+  ASSERT_TRUE(arena.has_value());
+  // THEN the arena stores only the thresholds and one offset per table
+  EXPECT_EQ(arena->GetMemoryUsage(),
+            sizeof(game_dice_cpp::TableArena) + (4000 * sizeof(int)) +
+                (1001 * sizeof(std::size_t)));
+  EXPECT_LT(arena->GetMemoryUsage(),
+            1000 * (sizeof(game_dice_cpp::DynamicProbabilityTable) +
+                    (4 * sizeof(int))));
+}
@@ -0,0 +1,203 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include "TableArena.h"
+#include "TableFile.h"
+
+namespace {
+// Builds an arena of tables with zero and negative weights.
+game_dice_cpp::TableArena MakeTestArena() {
+  std::vector<std::vector<int>> tables;
+  for (std::size_t size = 1; size <= 20; ++size) {
+    std::vector<int> weights(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      weights[i] = static_cast<int>((i * 5 + size) % 4) - 1;
+    }
+    weights.back() = 2;
+    tables.push_back(weights);
+  }
+  return *game_dice_cpp::TableArena::Make(tables);
+}
+
+// Copies serialized bytes into 8-byte aligned storage.
+std::vector<std::uint64_t> AlignedCopy(const std::vector<std::byte>& bytes) {
+  std::vector<std::uint64_t> words((bytes.size() + 7) / 8);
+  std::memcpy(words.data(), bytes.data(), bytes.size());
+  return words;
+}
+
+// Replaces the threshold at index in serialized bytes and recomputes the
+// checksum, so that only the threshold check can reject the file.
+std::vector<std::uint64_t> ResealedWithThreshold(
+    const std::vector<std::byte>& serialized, std::size_t table_count,
+    std::size_t index, int threshold) {
+  auto words = AlignedCopy(serialized);
+  auto bytes = std::as_writable_bytes(std::span(words));
+  const std::size_t header_size = sizeof(game_dice_cpp::TableFileHeader);
+  std::memcpy(bytes.data() + header_size +
+                  ((table_count + 1) * sizeof(std::uint64_t)) +
+                  (index * sizeof(int)),
+              &threshold, sizeof(threshold));
+  game_dice_cpp::TableFileHeader header;
+  std::memcpy(&header, bytes.data(), header_size);
+  header.checksum = game_dice_cpp::TableFileChecksum(
+      std::span<const std::byte>(bytes.data(), serialized.size())
+          .subspan(header_size));
+  std::memcpy(bytes.data(), &header, header_size);
+  return words;
+}
+
+// Checks that every table in actual matches the arena for every roll.
+template <typename Tables>
+void ExpectSameTables(const game_dice_cpp::TableArena& expected,
+                      const Tables& actual) {
+  ASSERT_EQ(actual.GetNumberOfTables(), expected.GetNumberOfTables());
+  for (std::size_t t = 0; t < expected.GetNumberOfTables(); ++t) {
+    const auto expected_table = expected.GetTable(t);
+    const auto actual_table = actual.GetTable(t);
+    ASSERT_EQ(actual_table.GetTotalWeight(), expected_table.GetTotalWeight());
+    for (int roll = 0; roll <= expected_table.GetTotalWeight() + 1; ++roll) {
+      EXPECT_EQ(actual_table.GetOutcomeIndex(roll),
+                expected_table.GetOutcomeIndex(roll));
+    }
+  }
+}
+}  // namespace
+
+TEST(TableFileTest, SerializedTablesReadBackUnchanged) {
+  // GIVEN an arena of tables
+  const auto arena = MakeTestArena();
+  // WHEN it is serialized and viewed in place
+  const auto words = AlignedCopy(game_dice_cpp::SerializeTableFile(arena));
+  const auto bytes = std::as_bytes(std::span(words));
+  const auto view = game_dice_cpp::TableFileView::Make(bytes);
+  // THEN every table matches the arena
+  ASSERT_TRUE(view.has_value());
+  ExpectSameTables(arena, *view);
+}
+
+TEST(TableFileTest, ViewServesTablesFromTheBytes) {
+  // GIVEN a serialized arena
+  const auto arena = MakeTestArena();
+  const auto words = AlignedCopy(game_dice_cpp::SerializeTableFile(arena));
+  const auto bytes = std::as_bytes(std::span(words));
+  // WHEN a table is viewed
+  const auto view = game_dice_cpp::TableFileView::Make(bytes);
+  ASSERT_TRUE(view.has_value());
+  const auto thresholds = view->GetTable(3).GetThresholds();
+  // THEN its thresholds point into the bytes rather than a copy
+  const auto* first = reinterpret_cast<const std::byte*>(thresholds.data());
+  EXPECT_GE(first, bytes.data());
+  EXPECT_LE(first + thresholds.size_bytes(), bytes.data() + bytes.size());
+}
+
+TEST(TableFileTest, CorruptedBytesAreRejected) {
+  // GIVEN a serialized arena
+  const auto serialized = game_dice_cpp::SerializeTableFile(MakeTestArena());
+  // WHEN any single byte is changed
+  // THEN the file is rejected
+  for (std::size_t i = 0; i < serialized.size(); ++i) {
+    auto words = AlignedCopy(serialized);
+    auto bytes = std::as_writable_bytes(std::span(words));
+    bytes[i] ^= std::byte{0x10};
+    EXPECT_FALSE(game_dice_cpp::TableFileView::Make(
+                     std::span<const std::byte>(bytes.data(), serialized.size()))
+                     .has_value())
+        << "FAILURE: Accepted corrupt byte " << i << ".";
+  }
+}
+
+TEST(TableFileTest, InvalidThresholdsWithValidChecksumAreRejected) {
+  // GIVEN a serialized arena of tables {1, 2, 3} and {4}
+  const std::vector<std::vector<int>> tables = {{1, 2, 3}, {4}};
+  const auto serialized = game_dice_cpp::SerializeTableFile(
+      *game_dice_cpp::TableArena::Make(tables));
+  const auto accepted = [&serialized](std::size_t index, int threshold) {
+    const auto words = ResealedWithThreshold(serialized, 2, index, threshold);
+    return game_dice_cpp::TableFileView::Make(
+               std::span<const std::byte>(
+                   std::as_bytes(std::span(words)).data(), serialized.size()))
+        .has_value();
+  };
+  // WHEN a threshold is rewritten and the checksum is updated to match
+  // THEN thresholds that still describe valid tables are accepted
+  EXPECT_TRUE(accepted(1, 3));
+  EXPECT_TRUE(accepted(0, 0));
+  // AND decreasing, negative or all-zero thresholds are rejected
+  EXPECT_FALSE(accepted(1, 7));
+  EXPECT_FALSE(accepted(0, -1));
+  EXPECT_FALSE(accepted(3, 0));
+}
+
+TEST(TableFileTest, TruncatedOrPaddedBytesAreRejected) {
+  // GIVEN a serialized arena
+  const auto serialized = game_dice_cpp::SerializeTableFile(MakeTestArena());
+  auto words = AlignedCopy(serialized);
+  words.push_back(0);
+  const auto bytes = std::as_bytes(std::span(words));
+  // WHEN the bytes are cut short or have bytes left over
+  // THEN the file is rejected
+  EXPECT_FALSE(game_dice_cpp::TableFileView::Make(bytes.first(0)));
+  EXPECT_FALSE(game_dice_cpp::TableFileView::Make(bytes.first(39)));
+  EXPECT_FALSE(game_dice_cpp::TableFileView::Make(
+      bytes.first(serialized.size() - 4)));
+  EXPECT_FALSE(game_dice_cpp::TableFileView::Make(
+      bytes.first(serialized.size() + 4)));
+}
+
+TEST(TableFileTest, MappedFileMatchesArena) {
+  // GIVEN an arena saved to a file
+  const auto arena = MakeTestArena();
+  const auto path =
+      std::filesystem::temp_directory_path() / "game_dice_cpp_table_file_test";
+  ASSERT_TRUE(game_dice_cpp::SaveTableFile(arena, path));
+  // WHEN the file is mapped
+  {
+    const auto file = game_dice_cpp::MappedTableFile::Open(path);
+    // THEN every table matches the arena
+    ASSERT_TRUE(file.has_value());
+    ExpectSameTables(arena, *file);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(TableFileTest, OpenMissingFileReturnsNullOpt) {
+  // GIVEN a path with no file
+  const auto path = std::filesystem::temp_directory_path() /
+                    "game_dice_cpp_table_file_test_missing";
+  std::filesystem::remove(path);
+  // WHEN the file is opened
+  // THEN there is nothing returned
+  EXPECT_FALSE(game_dice_cpp::MappedTableFile::Open(path).has_value());
+}
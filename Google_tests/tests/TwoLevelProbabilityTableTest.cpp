@@ -0,0 +1,88 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "TwoLevelProbabilityTable.h"
+
+TEST(TwoLevelProbabilityTableTest, MakeWithEmptyWeightsReturnsNullOpt) {
+  // GIVEN a table defined with no weights
+  const auto table_A =
+      game_dice_cpp::TwoLevelProbabilityTable::Make(std::span<const int>{});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(TwoLevelProbabilityTableTest, MakeWithAllZeroWeightsReturnsNullOpt) {
+  // GIVEN a table defined with zero or negative weights
+  const auto table_A =
+      game_dice_cpp::TwoLevelProbabilityTable::Make(std::to_array({0, -1, 0}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(TwoLevelProbabilityTableTest, MakeWithOverflowWeightsDoesNotConstruct) {
+  // GIVEN a table defined with weights that sum past the limit of an int
+  const auto table_A = game_dice_cpp::TwoLevelProbabilityTable::Make(
+      std::to_array({std::numeric_limits<int>::max(), 1}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(table_A.has_value());
+}
+
+TEST(TwoLevelProbabilityTableTest, GetOutcomeIndexMatchesDynamicTable) {
+  // GIVEN tables that fill part of a block, exactly one block, many blocks,
+  // and enough blocks for several levels above the leaves
+  for (const std::size_t size : {1U, 5U, 15U, 16U, 17U, 32U, 33U, 250U, 256U,
+                                 257U, 4'101U, 70'000U}) {
+    std::vector<int> weights(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      weights[i] = static_cast<int>((i * 5) % 4);
+    }
+    weights.front() = 2;
+    const auto two_level_table =
+        game_dice_cpp::TwoLevelProbabilityTable::Make(weights);
+    const auto dynamic_table =
+        game_dice_cpp::DynamicProbabilityTable::Make(weights);
+    ASSERT_TRUE(two_level_table.has_value());
+    ASSERT_TRUE(dynamic_table.has_value());
+    EXPECT_EQ(two_level_table->GetTotalWeight(),
+              dynamic_table->GetTotalWeight());
+    // WHEN every roll, including out of range rolls, is looked up
+    // THEN the tables agree
+    for (int roll = -2; roll <= dynamic_table->GetTotalWeight() + 2; ++roll) {
+      EXPECT_EQ(two_level_table->GetOutcomeIndex(roll),
+                dynamic_table->GetOutcomeIndex(roll))
+          << "FAILURE: Mismatch for roll " << roll << " with " << size
+          << " outcomes.";
+    }
+  }
+}
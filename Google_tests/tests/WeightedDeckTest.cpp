@@ -0,0 +1,107 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "WeightedDeck.h"
+
+TEST(WeightedDeckTest, MakeWithEmptyWeightsReturnsNullOpt) {
+  // GIVEN a deck defined with no weights
+  const auto deck_A =
+      game_dice_cpp::WeightedDeck::Make(std::span<const int>{});
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(deck_A.has_value());
+}
+
+TEST(WeightedDeckTest, MakeWithOverflowWeightsDoesNotConstruct) {
+  // GIVEN a deck defined with weights that sum past the limit of an int
+  const auto deck_A = game_dice_cpp::WeightedDeck::Make(
+      std::to_array({std::numeric_limits<int>::max(), 1}));
+  // WHEN Make is called
+  // THEN there is nothing returned
+  EXPECT_FALSE(deck_A.has_value());
+}
+
+TEST(WeightedDeckTest, DrawingTheWholeDeckDrawsEveryCardOnce) {
+  // GIVEN a deck with zero and negative weight cards
+  auto deck_A = game_dice_cpp::WeightedDeck::Make(
+      std::to_array({3, 0, 1, 7, -2, 2, 5}));
+  ASSERT_TRUE(deck_A.has_value());
+  EXPECT_EQ(deck_A->GetRemainingWeight(), 18);
+  auto engine = std::mt19937(42);
+  // WHEN the deck is drawn until it is empty
+  std::vector<int> cards;
+  while (const auto card = deck_A->Draw(engine)) {
+    cards.push_back(*card);
+  }
+  // THEN every card with a positive weight was drawn exactly once
+  std::ranges::sort(cards);
+  EXPECT_EQ(cards, std::vector<int>({0, 2, 3, 5, 6}));
+  EXPECT_TRUE(deck_A->IsEmpty());
+  EXPECT_EQ(deck_A->GetRemainingWeight(), 0);
+  EXPECT_EQ(deck_A->GetDrawnCards().size(), 5U);
+}
+
+TEST(WeightedDeckTest, ResetRestoresTheWholeDeck) {
+  // GIVEN a partially drawn deck
+  auto deck_A = game_dice_cpp::WeightedDeck::Make(std::to_array({4, 1, 2, 9}));
+  ASSERT_TRUE(deck_A.has_value());
+  auto engine = std::mt19937(7);
+  ASSERT_TRUE(deck_A->Draw(engine).has_value());
+  ASSERT_TRUE(deck_A->Draw(engine).has_value());
+  // WHEN the deck is reset
+  deck_A->Reset();
+  // THEN every card can be drawn again
+  EXPECT_EQ(deck_A->GetRemainingWeight(), 16);
+  EXPECT_TRUE(deck_A->GetDrawnCards().empty());
+  std::vector<int> cards;
+  while (const auto card = deck_A->Draw(engine)) {
+    cards.push_back(*card);
+  }
+  std::ranges::sort(cards);
+  EXPECT_EQ(cards, std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST(WeightedDeckTest, FirstDrawFollowsTheWeights) {
+  // GIVEN a deck with very uneven weights
+  auto deck_A = game_dice_cpp::WeightedDeck::Make(std::to_array({1, 3}));
+  ASSERT_TRUE(deck_A.has_value());
+  auto engine = std::mt19937(42);
+  // WHEN the first draw is repeated many times
+  int heavy_draws = 0;
+  constexpr int trials = 40'000;
+  for (int trial = 0; trial < trials; ++trial) {
+    heavy_draws += static_cast<int>(deck_A->Draw(engine) == 1);
+    deck_A->Reset();
+  }
+  // THEN the heavy card is drawn about three times as often
+  EXPECT_NEAR(static_cast<double>(heavy_draws) / trials, 0.75, 0.01);
+}
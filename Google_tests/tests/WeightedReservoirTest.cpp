@@ -0,0 +1,153 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DynamicProbabilityTable.h"
+#include "WeightedReservoir.h"
+
+namespace {
+// Returns the exact chance that each outcome is among the first two draws
+// without replacement.
+std::vector<double> InclusionProbabilitiesOfTwo(
+    const std::vector<int>& weights) {
+  double total = 0.0;
+  for (const int weight : weights) {
+    total += weight;
+  }
+  std::vector<double> probabilities(weights.size(), 0.0);
+  for (std::size_t first = 0; first < weights.size(); ++first) {
+    const double first_chance = weights[first] / total;
+    probabilities[first] += first_chance;
+    for (std::size_t second = 0; second < weights.size(); ++second) {
+      if (second != first) {
+        probabilities[second] +=
+            first_chance * weights[second] / (total - weights[first]);
+      }
+    }
+  }
+  return probabilities;
+}
+}  // namespace
+
+TEST(WeightedReservoirTest, EmptyReservoirSelectsNothing) {
+  // GIVEN a reservoir of size zero
+  game_dice_cpp::WeightedReservoir<int> reservoir(0);
+  auto engine = std::mt19937(42);
+  // WHEN candidates are offered
+  reservoir.Offer(1, 10, engine);
+  reservoir.Offer(2, 10, engine);
+  // THEN nothing is selected
+  EXPECT_EQ(reservoir.GetSize(), 0U);
+  EXPECT_TRUE(reservoir.GetSample().empty());
+}
+
+TEST(WeightedReservoirTest, LargeReservoirSelectsEveryWeightedCandidate) {
+  // GIVEN a stream of (id, weight) pairs with zero and negative weights
+  const std::vector<std::pair<std::string, int>> candidates{
+      {"sword", 3}, {"shield", 0}, {"potion", 5}, {"curse", -1}, {"gem", 1}};
+  auto engine = std::mt19937(42);
+  // WHEN more candidates are requested than have weight
+  auto sample = game_dice_cpp::SampleWeightedReservoir(candidates, 10, engine);
+  // THEN every weighted candidate is selected exactly once
+  std::ranges::sort(sample);
+  EXPECT_EQ(sample, std::vector<std::string>({"gem", "potion", "sword"}));
+}
+
+TEST(WeightedReservoirTest, SampleMatchesDrawingWithoutReplacement) {
+  // GIVEN a stream long enough for the reservoir to skip candidates
+  std::vector<int> weights(24);
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = static_cast<int>(i % 6) + 1;
+  }
+  std::vector<std::pair<int, int>> candidates;
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    candidates.emplace_back(static_cast<int>(i), weights[i]);
+  }
+  const std::vector<double> expected = InclusionProbabilitiesOfTwo(weights);
+  auto engine = std::mt19937(42);
+  // WHEN two candidates are selected many times
+  constexpr int trials = 100'000;
+  std::vector<int> counts(weights.size(), 0);
+  for (int trial = 0; trial < trials; ++trial) {
+    for (const int id :
+         game_dice_cpp::SampleWeightedReservoir(candidates, 2, engine)) {
+      ++counts[static_cast<std::size_t>(id)];
+    }
+  }
+  // THEN each candidate is selected as often as drawing twice would select it
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    EXPECT_NEAR(static_cast<double>(counts[i]) / trials, expected[i], 0.006)
+        << "FAILURE: Mismatch for candidate " << i << ".";
+  }
+}
+
+TEST(WeightedReservoirTest, SampleDistinctMatchesDrawingWithoutReplacement) {
+  // GIVEN a table with a dominant outcome, so repeats force the reservoir path
+  const std::vector<int> weights{400, 1, 2, 3, 4, 0, 5};
+  const auto table_A = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  ASSERT_TRUE(table_A.has_value());
+  const std::vector<double> expected = InclusionProbabilitiesOfTwo(weights);
+  auto engine = std::mt19937(42);
+  // WHEN two distinct outcomes are selected many times
+  constexpr int trials = 100'000;
+  std::vector<int> counts(weights.size(), 0);
+  for (int trial = 0; trial < trials; ++trial) {
+    const std::vector<int> sample = table_A->SampleDistinct(2, engine);
+    ASSERT_EQ(sample.size(), 2U);
+    ASSERT_NE(sample[0], sample[1]);
+    for (const int outcome : sample) {
+      ++counts[static_cast<std::size_t>(outcome)];
+    }
+  }
+  // THEN each outcome is selected as often as drawing twice would select it
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    EXPECT_NEAR(static_cast<double>(counts[i]) / trials, expected[i], 0.006)
+        << "FAILURE: Mismatch for outcome " << i << ".";
+  }
+}
+
+TEST(WeightedReservoirTest, SampleDistinctFallbackSkipsEveryPickedOutcome) {
+  // GIVEN heavy outcomes that fill the rejection phase with repeats
+  const std::vector<int> weights{1'000, 0, 1'000, 1, 1'000, 1, 0, 1, 1};
+  const auto table_A = game_dice_cpp::DynamicProbabilityTable::Make(weights);
+  ASSERT_TRUE(table_A.has_value());
+  auto engine = std::mt19937(42);
+  for (int trial = 0; trial < 1'000; ++trial) {
+    // WHEN every outcome with a positive weight is selected
+    std::vector<int> sample = table_A->SampleDistinct(7, engine);
+    // THEN each one appears exactly once
+    std::ranges::sort(sample);
+    ASSERT_EQ(sample, (std::vector<int>{0, 2, 3, 4, 5, 7, 8}));
+  }
+}
@@ -0,0 +1,62 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include "Xoshiro256StarStar.h"
+
+TEST(Xoshiro256StarStarTest, MatchesReferenceOutput) {
+  // GIVEN the engine with the state {1, 2, 3, 4}
+  game_dice_cpp::Xoshiro256StarStar engine(
+      game_dice_cpp::Xoshiro256StarStar::State{1, 2, 3, 4});
+  // THEN it matches the reference implementation
+  constexpr std::array<std::uint64_t, 4> expected = {
+      0x2d00U, 0x0U, 0x5a00'7080U, 0x10e0'0000'0000'9d80U};
+  for (const std::uint64_t value : expected) {
+    EXPECT_EQ(engine(), value);
+  }
+}
+
+TEST(Xoshiro256StarStarTest, SeedIsExpandedWithSplitMix64) {
+  // GIVEN the engine seeded with 42
+  game_dice_cpp::Xoshiro256StarStar engine(42);
+  // THEN its state is the first four SplitMix64 values for that seed
+  game_dice_cpp::SplitMix64 expander(42);
+  const game_dice_cpp::Xoshiro256StarStar::State expected = {
+      expander(), expander(), expander(), expander()};
+  EXPECT_EQ(engine.GetState(), expected);
+  EXPECT_EQ(engine(), 0x1578'0b2e'0c2e'c716U);
+}
+
+TEST(Xoshiro256StarStarTest, ZeroStateIsReplaced) {
+  // GIVEN the all-zero state, which would only produce zeros
+  const game_dice_cpp::Xoshiro256StarStar engine(
+      game_dice_cpp::Xoshiro256StarStar::State{});
+  // THEN the engine starts from the default seed instead
+  EXPECT_EQ(engine, game_dice_cpp::Xoshiro256StarStar());
+}
@@ -0,0 +1,56 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "TableFile.h"
+
+// this is the standard entry point for libFuzzer
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  // copy into 8-byte aligned storage, as a file mapping would be
+  std::vector<uint64_t> words((size + 7) / 8);
+  if (size > 0) {
+    std::memcpy(words.data(), data, size);
+  }
+  const auto bytes =
+      std::span(reinterpret_cast<const std::byte *>(words.data()), size);
+  // feed the fuzzed data into the file parser
+  const auto view = game_dice_cpp::TableFileView::Make(bytes);
+  if (!view) {
+    return 0; // rejected... tell libfuzzer to try again
+  }
+  // every accepted table must be safe to use
+  for (size_t i = 0; i < view->GetNumberOfTables(); ++i) {
+    const auto table = view->GetTable(i);
+    [[maybe_unused]] auto result =
+        table.GetOutcomeIndex(table.GetTotalWeight());
+  }
+  // return 0 to indicate successful execution of target
+  return 0;
+}
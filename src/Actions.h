@@ -25,26 +25,42 @@
 
 #ifndef GAME_DICE_CPP_SRC_ACTION_H
 #define GAME_DICE_CPP_SRC_ACTION_H
-#include <random>
-
+#include "BoundedRandom.h"
 #include "Dice.h"
+#include "PreparedDice.h"
 
 namespace game_dice_cpp {
 
 // Roll a die to generate a random value.
 //
-// This function creates a uniform integer distribution based on the die
-// geometry and uses the provided engine to select a result.
+// This function draws a uniform face from the die geometry with the library's
+// own multiply-shift generator (see BoundedUniform), so the same engine state
+// gives the same result with every standard library and on every platform.
+//
+// The result has the same type as the faces of the die, so a die with 64-bit
+// faces draws a 64-bit value directly.
 //
 // die: The die to roll (defines the range [1, N])
 // engine: A C++ STL compatible random number engine
-template <typename Engine>
-[[nodiscard]] int Roll(const Dice& die, Engine& engine) {
-  // create the uniform distribution from 1->N on the stack
-  // NOLINTNEXTLINE(misc-const-correctness): STL dists not const-callable
-  std::uniform_int_distribution<int> distribution(1, die.GetNumSides());
-  // pull a number from the distribution using the provided entropy source
-  return distribution(engine);
+template <typename Sides, typename Engine>
+[[nodiscard]] Sides Roll(const BasicDice<Sides>& die, Engine& engine) {
+  using Word = BoundedUniformWord<Sides>;
+  // pick a face in [0, N) and shift it to [1, N]
+  const Word face = BoundedUniform<Word>::Generate(
+      static_cast<Word>(die.GetNumSides()), engine);
+  return static_cast<Sides>(face + 1);
+}
+
+// Roll a prepared die to generate a random value.
+//
+// This gives the same result as rolling the die it was prepared from, but
+// skips computing the rejection threshold.
+//
+// die: The prepared die to roll (defines the range [1, N])
+// engine: A C++ STL compatible random number engine
+template <typename Sides, typename Engine>
+[[nodiscard]] Sides Roll(const BasicPreparedDice<Sides>& die, Engine& engine) {
+  return static_cast<Sides>(die.GetGenerator()(engine) + 1);
 }
 
 }  // namespace game_dice_cpp
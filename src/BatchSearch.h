@@ -0,0 +1,93 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_BATCHSEARCH_H
+#define GAME_DICE_CPP_SRC_BATCHSEARCH_H
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace game_dice_cpp {
+
+// Maps a batch of rolls to outcome indexes over sorted cumulative thresholds.
+//
+// The result for each roll is the lower bound of the roll in thresholds,
+// clamped to the last outcome, exactly like GetOutcomeIndex. Rolls are
+// processed in groups whose branchless binary searches advance in lock-step:
+// every search in a group has the same length at every step, so the loads of
+// one step are independent of each other and their cache misses overlap.
+//
+// Only the first min(rolls.size(), out_indexes.size()) rolls are mapped.
+template <typename Weight>
+constexpr void InterleavedLowerBound(const std::span<const Weight> thresholds,
+                                     const std::span<const Weight> rolls,
+                                     const std::span<int> out_indexes) {
+  // the number of searches in flight at once
+  constexpr std::size_t group_size{8};
+  const std::size_t count = std::min(rolls.size(), out_indexes.size());
+  const std::size_t number_of_outcomes = thresholds.size();
+  const auto last_index = static_cast<int>(number_of_outcomes - 1);
+  // finishes a search that has narrowed down to a single threshold
+  const auto finish = [&](std::size_t base, Weight roll) {
+    const auto index =
+        static_cast<int>(base + static_cast<std::size_t>(thresholds[base] < roll));
+    return std::min(index, last_index);
+  };
+  std::size_t first = 0;
+  for (; first + group_size <= count; first += group_size) {
+    std::array<std::size_t, group_size> bases{};
+    std::size_t length = number_of_outcomes;
+    while (length > 1) {
+      const std::size_t half = length / 2;
+      for (std::size_t lane = 0; lane < group_size; ++lane) {
+        // move right by half when the probe is below the roll
+        bases[lane] += half * static_cast<std::size_t>(
+                                  thresholds[bases[lane] + half - 1] <
+                                  rolls[first + lane]);
+      }
+      length -= half;
+    }
+    for (std::size_t lane = 0; lane < group_size; ++lane) {
+      out_indexes[first + lane] = finish(bases[lane], rolls[first + lane]);
+    }
+  }
+  // the tail is too short to interleave
+  for (; first < count; ++first) {
+    std::size_t base = 0;
+    std::size_t length = number_of_outcomes;
+    while (length > 1) {
+      const std::size_t half = length / 2;
+      base += half * static_cast<std::size_t>(thresholds[base + half - 1] <
+                                              rolls[first]);
+      length -= half;
+    }
+    out_indexes[first] = finish(base, rolls[first]);
+  }
+}
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_BATCHSEARCH_H
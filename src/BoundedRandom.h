@@ -0,0 +1,211 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_BOUNDEDRANDOM_H
+#define GAME_DICE_CPP_SRC_BOUNDEDRANDOM_H
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "./IntegerConcepts.h"
+
+#if defined(__SIZEOF_INT128__)
+#define GAME_DICE_CPP_HAS_INT128 1
+#endif
+
+namespace game_dice_cpp {
+
+// Draws uniformly random bits from any C++ STL compatible engine.
+//
+// The standard fixes the output of every engine but not of the distributions
+// built on them, so this only relies on Engine::operator(), min() and max().
+// An engine whose range is a power of two supplies all of its bits on every
+// call. Any other range (minstd_rand, for example) supplies half of its bits,
+// rounded up, which rejects fewer than one draw in 2^(bits - 2).
+template <typename Engine>
+struct EngineBits {
+  // The number of values the engine produces, minus one.
+  static constexpr std::uint64_t range_minus_one =
+      static_cast<std::uint64_t>(Engine::max() - Engine::min());
+  static constexpr bool is_power_of_two =
+      ((range_minus_one + 1) & range_minus_one) == 0;
+  // The number of uniform bits produced by one call of Draw.
+  static constexpr int bits =
+      is_power_of_two
+          ? static_cast<int>(std::bit_width(range_minus_one))
+          : (static_cast<int>(std::bit_width(range_minus_one + 1)) + 1) / 2;
+  static_assert(range_minus_one > 0, "the engine must produce two values");
+
+  // Returns a value in [0, 2^bits).
+  [[nodiscard]] static std::uint64_t Draw(Engine& engine) {
+    if constexpr (is_power_of_two) {
+      return static_cast<std::uint64_t>(engine() - Engine::min());
+    } else {
+      constexpr std::uint64_t block = std::uint64_t{1} << bits;
+      // the largest multiple of the block that fits in the engine range
+      constexpr std::uint64_t limit =
+          (range_minus_one + 1) - (range_minus_one + 1) % block;
+      while (true) {
+        const auto value = static_cast<std::uint64_t>(engine() - Engine::min());
+        if (value < limit) {
+          return value & (block - 1);
+        }
+      }
+    }
+  }
+};
+
+// Returns a uniformly random UInt, built from as many engine draws as needed.
+//
+// Draws are concatenated high to low, so the result depends only on the
+// sequence the engine produces and is identical on every platform.
+template <std::unsigned_integral UInt, typename Engine>
+[[nodiscard]] UInt UniformBits(Engine& engine) {
+  using Bits = EngineBits<Engine>;
+  constexpr int digits = std::numeric_limits<UInt>::digits;
+  if constexpr (Bits::bits >= digits) {
+    // a single draw is wide enough, keep its low bits
+    return static_cast<UInt>(Bits::Draw(engine));
+  } else {
+    UInt result = 0;
+    for (int filled = 0; filled < digits; filled += Bits::bits) {
+      result = static_cast<UInt>((result << Bits::bits) | Bits::Draw(engine));
+    }
+    return result;
+  }
+}
+
+// The full product of two UInts split into its high and low halves.
+template <std::unsigned_integral UInt>
+struct WideProduct {
+  UInt high;
+  UInt low;
+};
+
+// Multiplies two 32- or 64-bit values without losing the high half.
+template <std::unsigned_integral UInt>
+  requires(std::numeric_limits<UInt>::digits == 32 ||
+           std::numeric_limits<UInt>::digits == 64)
+[[nodiscard]] constexpr WideProduct<UInt> MultiplyWide(const UInt a,
+                                                       const UInt b) {
+  if constexpr (std::numeric_limits<UInt>::digits == 32) {
+    const std::uint64_t product = std::uint64_t{a} * b;
+    return {.high = static_cast<UInt>(product >> 32),
+            .low = static_cast<UInt>(product)};
+  } else {
+#ifdef GAME_DICE_CPP_HAS_INT128
+    __extension__ using UInt128 = unsigned __int128;
+    const UInt128 product = UInt128{a} * b;
+    return {.high = static_cast<UInt>(product >> 64),
+            .low = static_cast<UInt>(product)};
+#else
+    // schoolbook multiplication of the 32-bit halves
+    const std::uint64_t a_low = a & 0xffff'ffffU;
+    const std::uint64_t a_high = a >> 32;
+    const std::uint64_t b_low = b & 0xffff'ffffU;
+    const std::uint64_t b_high = b >> 32;
+    const std::uint64_t low_low = a_low * b_low;
+    const std::uint64_t high_low = a_high * b_low;
+    const std::uint64_t low_high = a_low * b_high;
+    const std::uint64_t middle =
+        (low_low >> 32) + (high_low & 0xffff'ffffU) + low_high;
+    return {.high = a_high * b_high + (high_low >> 32) + (middle >> 32),
+            .low = (middle << 32) | (low_low & 0xffff'ffffU)};
+#endif
+  }
+}
+
+// Generates uniform integers in [0, range) with Lemire's nearly divisionless
+// multiply-shift method.
+//
+// A random UInt x maps to the high half of x * range. The low half tells when
+// x fell into one of the few biased slots, which are rejected and redrawn. The
+// rejection threshold (2^N - range) % range is the only division, and
+// Generate computes it only on the rare draws whose low half is below range.
+// Construct a BoundedUniform once to precompute the threshold instead.
+template <std::unsigned_integral UInt>
+  requires(std::numeric_limits<UInt>::digits == 32 ||
+           std::numeric_limits<UInt>::digits == 64)
+class BoundedUniform {
+ private:
+  // The number of values to choose from.
+  UInt range_;
+  // Low halves below this value are rejected.
+  UInt threshold_;
+
+ public:
+  // Precomputes the rejection threshold for range values.
+  //
+  // range: The number of values to choose from, at least 1
+  constexpr explicit BoundedUniform(const UInt range)
+      : range_(range), threshold_(static_cast<UInt>(-range) % range) {}
+
+  // Retrieves the number of values to choose from.
+  [[nodiscard]] constexpr UInt GetRange() const noexcept { return range_; }
+
+  // Returns a uniform value in [0, range) using the precomputed threshold.
+  //
+  // engine: A C++ STL compatible random number engine
+  template <typename Engine>
+  [[nodiscard]] UInt operator()(Engine& engine) const {
+    WideProduct<UInt> product =
+        MultiplyWide(UniformBits<UInt>(engine), range_);
+    while (product.low < threshold_) {
+      product = MultiplyWide(UniformBits<UInt>(engine), range_);
+    }
+    return product.high;
+  }
+
+  // Returns a uniform value in [0, range) without a precomputed threshold.
+  //
+  // The output is identical to BoundedUniform(range)(engine).
+  //
+  // range: The number of values to choose from, at least 1
+  // engine: A C++ STL compatible random number engine
+  template <typename Engine>
+  [[nodiscard]] static UInt Generate(const UInt range, Engine& engine) {
+    WideProduct<UInt> product = MultiplyWide(UniformBits<UInt>(engine), range);
+    // the threshold is below range, so most draws never need it
+    if (product.low < range) {
+      const UInt threshold = static_cast<UInt>(-range) % range;
+      while (product.low < threshold) {
+        product = MultiplyWide(UniformBits<UInt>(engine), range);
+      }
+    }
+    return product.high;
+  }
+};
+
+// The unsigned word BoundedUniform uses to roll a die with Sides faces.
+template <CountingInteger Sides>
+using BoundedUniformWord =
+    std::conditional_t<(sizeof(Sides) <= sizeof(std::uint32_t)), std::uint32_t,
+                       std::uint64_t>;
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_BOUNDEDRANDOM_H
@@ -0,0 +1,267 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_COMPACTPROBABILITYTABLE_H
+#define GAME_DICE_CPP_SRC_COMPACTPROBABILITYTABLE_H
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+// How a CompactProbabilityTable stores its thresholds.
+enum class ThresholdEncoding : std::uint8_t {
+  // Pick whichever encoding below uses less memory.
+  kAuto,
+  // Cumulative thresholds in the narrowest unsigned type that holds the total
+  // weight.
+  kNarrow,
+  // Blocks of 16 weights in the narrowest unsigned type that holds the largest
+  // weight, each block with a 32-bit base (the threshold before the block).
+  kDeltaBlocks,
+};
+
+// A data structure that maps a linear range [1, N] to a set of weight indexes
+// with as little memory as possible.
+//
+// The thresholds live in a single allocation in one of the ThresholdEncoding
+// formats, and the object itself is a pointer and three small fields. Lookups
+// give the same result as DynamicProbabilityTable. A kDeltaBlocks lookup
+// searches the block bases and then decodes only the block it lands in.
+//
+// You should choose CompactProbabilityTable over DynamicProbabilityTable when
+// many small tables are resident at once.
+class CompactProbabilityTable {
+ public:
+  // The number of weights in one delta-encoded block.
+  static constexpr std::size_t block_size{16};
+
+ private:
+  // The encoded thresholds.
+  std::unique_ptr<std::byte[]> data_;
+  // The sum of all (non-negative) input weights.
+  int total_weight_;
+  // The number of outcomes in the table.
+  std::uint32_t number_of_outcomes_;
+  // The encoding of data_.
+  ThresholdEncoding encoding_;
+  // The size in bytes of one encoded threshold (kNarrow) or weight
+  // (kDeltaBlocks).
+  std::uint8_t element_size_;
+
+  CompactProbabilityTable(std::unique_ptr<std::byte[]>&& data, int total_weight,
+                          std::uint32_t number_of_outcomes,
+                          ThresholdEncoding encoding, std::uint8_t element_size)
+      : data_(std::move(data)),
+        total_weight_(total_weight),
+        number_of_outcomes_(number_of_outcomes),
+        encoding_(encoding),
+        element_size_(element_size) {}
+
+  // Returns the size in bytes of the narrowest unsigned type that holds value.
+  [[nodiscard]] static std::uint8_t NarrowestSize(int value) {
+    if (value <= std::numeric_limits<std::uint8_t>::max()) {
+      return 1;
+    }
+    if (value <= std::numeric_limits<std::uint16_t>::max()) {
+      return 2;
+    }
+    return 4;
+  }
+
+  [[nodiscard]] static std::size_t NumberOfBlocks(std::size_t size) {
+    return (size + block_size - 1) / block_size;
+  }
+
+  // Reads element index of an array of T that starts at bytes.
+  template <typename T>
+  [[nodiscard]] static int Load(const std::byte* bytes, std::size_t index) {
+    T value;
+    std::memcpy(&value, bytes + (index * sizeof(T)), sizeof(T));
+    return static_cast<int>(value);
+  }
+
+  // Writes element index of an array of T that starts at bytes.
+  template <typename T>
+  static void Store(std::byte* bytes, std::size_t index, int value) {
+    const auto narrow_value = static_cast<T>(value);
+    std::memcpy(bytes + (index * sizeof(T)), &narrow_value, sizeof(T));
+  }
+
+  // Calls function with a value of the unsigned type that is size bytes wide.
+  template <typename Function>
+  static decltype(auto) VisitSize(std::uint8_t size, Function&& function) {
+    switch (size) {
+      case 1:
+        return function(std::uint8_t{});
+      case 2:
+        return function(std::uint16_t{});
+      default:
+        return function(std::uint32_t{});
+    }
+  }
+
+  // Counts the elements of a sorted array of T that are below roll.
+  template <typename T>
+  [[nodiscard]] static std::size_t CountBelow(const std::byte* bytes,
+                                              std::size_t size, int roll) {
+    // branchless lower bound
+    std::size_t base = 0;
+    std::size_t length = size;
+    while (length > 1) {
+      const std::size_t half = length / 2;
+      base += half * static_cast<std::size_t>(
+                         Load<T>(bytes, base + half - 1) < roll);
+      length -= half;
+    }
+    return base + static_cast<std::size_t>(Load<T>(bytes, base) < roll);
+  }
+
+  [[nodiscard]] std::size_t LookUpNarrow(int roll) const {
+    return VisitSize(element_size_, [&]<typename T>(T) {
+      return CountBelow<T>(data_.get(), number_of_outcomes_, roll);
+    });
+  }
+
+  [[nodiscard]] std::size_t LookUpDeltaBlocks(int roll) const {
+    const std::size_t number_of_blocks = NumberOfBlocks(number_of_outcomes_);
+    // the last block whose base is below the roll (or the first block)
+    const std::size_t blocks_below =
+        CountBelow<std::uint32_t>(data_.get(), number_of_blocks, roll);
+    const std::size_t block = blocks_below - static_cast<std::size_t>(
+                                                 blocks_below > 0);
+    // decode only that block, adding its weights onto its base
+    const std::byte* weights =
+        data_.get() + (number_of_blocks * sizeof(std::uint32_t));
+    const std::size_t first = block * block_size;
+    const std::size_t last =
+        std::min(first + block_size, std::size_t{number_of_outcomes_});
+    int threshold = Load<std::uint32_t>(data_.get(), block);
+    return VisitSize(element_size_, [&]<typename T>(T) {
+      std::size_t count = first;
+      for (std::size_t i = first; i < last; ++i) {
+        threshold += Load<T>(weights, i);
+        count += static_cast<std::size_t>(threshold < roll);
+      }
+      return count;
+    });
+  }
+
+ public:
+  //
+  [[nodiscard]] static std::optional<game_dice_cpp::CompactProbabilityTable>
+  Make(const std::span<const int> weights,
+       ThresholdEncoding encoding = ThresholdEncoding::kAuto) {
+    // validation
+    const std::optional<int> total_weight = SumWeights(weights);
+    if (!total_weight.has_value() ||
+        weights.size() > std::numeric_limits<std::uint32_t>::max()) {
+      return std::nullopt;
+    }
+    const std::size_t size = weights.size();
+    const std::size_t number_of_blocks = NumberOfBlocks(size);
+    const std::uint8_t narrow_size = NarrowestSize(*total_weight);
+    const std::uint8_t delta_size =
+        NarrowestSize(std::ranges::max(weights | std::views::transform(
+                                                      ClampWeight)));
+    // pick the smaller encoding, preferring the simpler one on a tie
+    if (encoding == ThresholdEncoding::kAuto) {
+      const std::size_t narrow_bytes = size * narrow_size;
+      const std::size_t delta_bytes =
+          (number_of_blocks * sizeof(std::uint32_t)) + (size * delta_size);
+      encoding = delta_bytes < narrow_bytes ? ThresholdEncoding::kDeltaBlocks
+                                            : ThresholdEncoding::kNarrow;
+    }
+    std::unique_ptr<std::byte[]> data;
+    std::uint8_t element_size = 0;
+    if (encoding == ThresholdEncoding::kNarrow) {
+      element_size = narrow_size;
+      data = std::make_unique_for_overwrite<std::byte[]>(size * element_size);
+      VisitSize(element_size, [&]<typename T>(T) {
+        int threshold = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+          threshold += ClampWeight(weights[i]);
+          Store<T>(data.get(), i, threshold);
+        }
+      });
+    } else {
+      element_size = delta_size;
+      data = std::make_unique_for_overwrite<std::byte[]>(
+          (number_of_blocks * sizeof(std::uint32_t)) + (size * element_size));
+      std::byte* block_weights =
+          data.get() + (number_of_blocks * sizeof(std::uint32_t));
+      VisitSize(element_size, [&]<typename T>(T) {
+        int threshold = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+          // every block starts from the threshold before it
+          if (i % block_size == 0) {
+            Store<std::uint32_t>(data.get(), i / block_size, threshold);
+          }
+          const int weight = ClampWeight(weights[i]);
+          Store<T>(block_weights, i, weight);
+          threshold += weight;
+        }
+      });
+    }
+    return CompactProbabilityTable(std::move(data), *total_weight,
+                                   static_cast<std::uint32_t>(size), encoding,
+                                   element_size);
+  }
+  // Returns the exact die size required to drive this table.
+  [[nodiscard]] int GetTotalWeight() const { return total_weight_; }
+
+  // Returns the encoding chosen at Make time.
+  [[nodiscard]] ThresholdEncoding GetEncoding() const { return encoding_; }
+
+  // Returns the number of bytes used by the table, including the object.
+  [[nodiscard]] std::size_t GetMemoryUsage() const {
+    std::size_t data_bytes = std::size_t{number_of_outcomes_} * element_size_;
+    if (encoding_ == ThresholdEncoding::kDeltaBlocks) {
+      data_bytes += NumberOfBlocks(number_of_outcomes_) * sizeof(std::uint32_t);
+    }
+    return sizeof(*this) + data_bytes;
+  }
+
+  // Maps a value (example: from a die roll) to an outcome index.
+  [[nodiscard]] int GetOutcomeIndex(int roll) const {
+    const std::size_t index = encoding_ == ThresholdEncoding::kNarrow
+                                  ? LookUpNarrow(roll)
+                                  : LookUpDeltaBlocks(roll);
+    // clamp value within range of table
+    return static_cast<int>(
+        std::min(index, std::size_t{number_of_outcomes_} - 1));
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_COMPACTPROBABILITYTABLE_H
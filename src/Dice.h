@@ -29,16 +29,22 @@
 #include <algorithm>
 #include <limits>
 
+#include "./IntegerConcepts.h"
+
 namespace game_dice_cpp {
 
 // An immutable descriptor of a die geometry.
 // The Dice class represents the physical properties of a dice (number of
 // sides). It is a lightweight, data-oriented structure that contains no rolling
 // logic or mutable state.
-class Dice {
+//
+// Sides is the integer type of the faces. Use a 64-bit type to drive tables
+// whose total weight does not fit in an int.
+template <CountingInteger Sides>
+class BasicDice {
  private:
   // The number of faces on this die.
-  int num_sides_;
+  Sides num_sides_;
 
  public:
   // Constructs a Dice with a specified number of sides.
@@ -47,15 +53,20 @@ class Dice {
   //
   // sides: The number of sides.
   //  - minimum: 2 (example: a coin)
-  //  - maximum std::numeric_limits<int>::max() - 1
-  constexpr explicit Dice(int sides)
-      : num_sides_(std::clamp(sides, 2, std::numeric_limits<int>::max() - 1)) {}
+  //  - maximum std::numeric_limits<Sides>::max() - 1
+  constexpr explicit BasicDice(Sides sides)
+      : num_sides_(std::clamp(
+            sides, Sides{2},
+            static_cast<Sides>(std::numeric_limits<Sides>::max() - 1))) {}
   // Retrieves the number of sides.
-  [[nodiscard]] constexpr int GetNumSides() const noexcept {
+  [[nodiscard]] constexpr Sides GetNumSides() const noexcept {
     return num_sides_;
   }
 };
 
+// The default die, with int faces.
+using Dice = BasicDice<int>;
+
 }  // namespace game_dice_cpp
 
 #endif  // GAME_DICE_CPP_SRC_DICE_H
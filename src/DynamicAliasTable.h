@@ -0,0 +1,163 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_DYNAMICALIASTABLE_H
+#define GAME_DICE_CPP_SRC_DYNAMICALIASTABLE_H
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+// A data structure that maps a linear range [1, N] to a set of weight indexes
+// in constant time.
+//
+// This is the Walker/Vose alias method built with exact integer arithmetic.
+// Every outcome owns one column of height GetTotalWeight(). A column is split
+// between its own outcome and a single alias outcome, so a lookup is one
+// division and one comparison regardless of the number of outcomes.
+//
+// You should choose DynamicAliasTable over DynamicProbabilityTable when the
+// table is large and sampled far more often than it is built.
+class DynamicAliasTable {
+ private:
+  // One column of the alias table.
+  struct Column {
+    // Rolls in the column below this value select the column's own outcome.
+    int threshold;
+    // The outcome selected by every other roll in the column.
+    int alias;
+  };
+  // One column per outcome.
+  std::vector<Column> columns_;
+  // The sum of all (non-negative) input weights.
+  int total_weight_;
+
+  explicit DynamicAliasTable(std::vector<Column>&& columns, int total_weight)
+      : columns_(std::move(columns)), total_weight_(total_weight) {}
+
+ public:
+  //
+  [[nodiscard]] static std::optional<game_dice_cpp::DynamicAliasTable> Make(
+      const std::span<const int> weights) {
+    // validation
+    const std::optional<int> total_weight = SumWeights(weights);
+    if (!total_weight.has_value()) {
+      return std::nullopt;
+    }
+    const auto total = static_cast<std::uint64_t>(*total_weight);
+    const std::size_t number_of_outcomes = weights.size();
+    // scale every weight by the number of outcomes so that the average column
+    // height is exactly total_weight
+    std::vector<std::uint64_t> scaled_weights;
+    scaled_weights.reserve(number_of_outcomes);
+    for (const int weight : weights) {
+      scaled_weights.push_back(static_cast<std::uint64_t>(ClampWeight(weight)) *
+                               number_of_outcomes);
+    }
+    // sort the columns into under-full and over-full work lists
+    std::vector<int> small;
+    std::vector<int> large;
+    small.reserve(number_of_outcomes);
+    large.reserve(number_of_outcomes);
+    for (std::size_t i = 0; i < number_of_outcomes; ++i) {
+      if (scaled_weights[i] < total) {
+        small.push_back(static_cast<int>(i));
+      } else {
+        large.push_back(static_cast<int>(i));
+      }
+    }
+    // every column starts as a full column of its own outcome
+    std::vector<Column> columns(number_of_outcomes);
+    for (std::size_t i = 0; i < number_of_outcomes; ++i) {
+      columns[i] = Column{.threshold = *total_weight,
+                          .alias = static_cast<int>(i)};
+    }
+    // top up each under-full column with the excess of an over-full one
+    while (!small.empty() && !large.empty()) {
+      const auto small_index = static_cast<std::size_t>(small.back());
+      small.pop_back();
+      const int large_outcome = large.back();
+      const auto large_index = static_cast<std::size_t>(large_outcome);
+      columns[small_index] = Column{
+          .threshold = static_cast<int>(scaled_weights[small_index]),
+          .alias = large_outcome};
+      // move the donated height out of the over-full column
+      scaled_weights[large_index] -= total - scaled_weights[small_index];
+      if (scaled_weights[large_index] < total) {
+        large.pop_back();
+        small.push_back(large_outcome);
+      }
+    }
+    // the arithmetic is exact, so any column left in a work list is full
+    return DynamicAliasTable(std::move(columns), *total_weight);
+  }
+  // Returns the sum of all weights in the table.
+  [[nodiscard]] int GetTotalWeight() const { return total_weight_; }
+
+  // Returns the exact die size required to drive this table.
+  //
+  // This is GetTotalWeight() multiplied by the number of outcomes.
+  [[nodiscard]] std::uint64_t GetRollRange() const {
+    return static_cast<std::uint64_t>(total_weight_) * columns_.size();
+  }
+
+  // Maps a value in [1, GetRollRange()] to an outcome index.
+  //
+  // Values outside of that range are clamped into it.
+  [[nodiscard]] int GetOutcomeIndex(std::uint64_t roll) const {
+    // clamp value within range of table
+    const std::uint64_t offset =
+        std::clamp(roll, std::uint64_t{1}, GetRollRange()) - 1;
+    // split the roll into a column and a height within that column
+    const auto total = static_cast<std::uint64_t>(total_weight_);
+    const Column& column = columns_[offset / total];
+    const auto height = static_cast<int>(offset % total);
+    if (height < column.threshold) {
+      return static_cast<int>(offset / total);
+    }
+    return column.alias;
+  }
+
+  // Selects an outcome index using a single draw from the provided engine.
+  //
+  // engine: A C++ STL compatible random number engine
+  template <typename Engine>
+  [[nodiscard]] int Sample(Engine& engine) const {
+    // NOLINTNEXTLINE(misc-const-correctness): STL dists not const-callable
+    std::uniform_int_distribution<std::uint64_t> distribution(1,
+                                                              GetRollRange());
+    return GetOutcomeIndex(distribution(engine));
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_DYNAMICALIASTABLE_H
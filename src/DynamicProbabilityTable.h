@@ -26,16 +26,57 @@
 #ifndef GAME_DICE_CPP_SRC_DYNAMICPROBABILITYTABLE_H
 #define GAME_DICE_CPP_SRC_DYNAMICPROBABILITYTABLE_H
 #include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
-#include <numeric>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
 #include <span>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "./BatchSearch.h"
+#include "./IntegerConcepts.h"
+#include "./PrefixSum.h"
+#include "./WeightValidation.h"
+#include "./WeightedReservoir.h"
+
 namespace game_dice_cpp {
+// Optional acceleration structures for DynamicProbabilityTable.
+struct DynamicProbabilityTableOptions {
+  // The maximum number of buckets in the guide table. Zero disables it.
+  //
+  // The guide table splits the rolls into equal buckets and remembers where
+  // each bucket starts in the thresholds, so a lookup only has to search the
+  // few thresholds inside one bucket. A size close to the number of outcomes
+  // gives an expected constant lookup cost.
+  std::size_t guide_table_size{0};
+  // The largest value dense_lookup_max_weight can take effect with. Larger
+  // bounds are treated as this one, so the dense lookup table never grows past
+  // 2 MiB.
+  static constexpr int dense_lookup_weight_limit{1 << 20};
+  // The largest total weight that uses a dense lookup table. Zero disables it,
+  // like the DenseMaxWeight of StaticProbabilityTable.
+  //
+  // A dense lookup table stores the outcome index of every roll, so a lookup
+  // is a single load. It costs two bytes per unit of total weight and replaces
+  // the guide table when it is used.
+  int dense_lookup_max_weight{0};
+  // The number of threads used to build the thresholds. Zero uses every
+  // hardware thread.
+  //
+  // Only tables with hundreds of thousands of outcomes are split across
+  // threads. The thresholds are identical to a build on one thread. The chunk
+  // bookkeeping comes from the allocator of the table, but every started
+  // thread still allocates its own state from the global heap.
+  std::size_t build_threads{1};
+};
+
 // A data structure that maps a linear range [1, N] to a set of weight indexes.
 //
 // You should choose DynamicProbabilityTable when the number of outcomes is
@@ -48,60 +89,266 @@ namespace game_dice_cpp {
 //
 // You should choose DynamicProbabilityTable if flexibility is more important
 // than raw memory performance.
-class DynamicProbabilityTable {
+//
+// Weight is the integer type of the weights, thresholds and rolls. Use
+// BasicDynamicProbabilityTable<std::uint64_t> when the total weight does not
+// fit in an int.
+//
+// Allocator provides the storage of the table. Use the tables in
+// game_dice_cpp::pmr to build from a caller's std::pmr::memory_resource.
+template <CountingInteger Weight, typename Allocator = std::allocator<Weight>>
+class BasicDynamicProbabilityTable {
  private:
+  // The unsigned counterpart of Weight, for bucket arithmetic.
+  using UnsignedWeight = std::make_unsigned_t<Weight>;
+  // Allocator rebound to another element type.
+  template <typename T>
+  using Rebind =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
   // Cumulative upper bounds.
-  std::vector<int> thresholds_;
+  std::vector<Weight, Allocator> thresholds_;
+  // The first outcome index of every bucket of rolls. Empty when disabled.
+  //
+  // Bucket b holds the rolls in [(b << guide_shift_) + 1,
+  // (b + 1) << guide_shift_]. The final entry holds the last outcome index.
+  std::vector<int, Rebind<int>> guide_;
+  // The base-two logarithm of the number of rolls in every bucket.
+  int guide_shift_{0};
+  // The outcome index of every roll in [0, GetTotalWeight() + 1]. Empty when
+  // disabled.
+  std::vector<std::uint16_t, Rebind<std::uint16_t>> dense_;
 
   // Explicit Weight Initialization
   // The user must define exactly the "shape" of the probability distribution.
-  explicit DynamicProbabilityTable(std::vector<int>&& thresholds)
-      : thresholds_(std::move(thresholds)) {}
+  explicit BasicDynamicProbabilityTable(
+      std::vector<Weight, Allocator>&& thresholds)
+      : thresholds_(std::move(thresholds)),
+        guide_(Rebind<int>(thresholds_.get_allocator())),
+        dense_(Rebind<std::uint16_t>(thresholds_.get_allocator())) {}
 
- public:
+  // Returns true when a table of this size uses the dense lookup table.
+  [[nodiscard]] static bool UsesDenseLookup(
+      const Weight total_weight, const std::size_t number_of_outcomes,
+      const DynamicProbabilityTableOptions& options) {
+    const int max_weight =
+        std::min(options.dense_lookup_max_weight,
+                 DynamicProbabilityTableOptions::dense_lookup_weight_limit);
+    return std::cmp_less_equal(total_weight, max_weight) &&
+           number_of_outcomes <=
+               std::numeric_limits<std::uint16_t>::max() + std::size_t{1};
+  }
+
+  // Returns the smallest power-of-two bucket width, as a shift, that keeps the
+  // number of buckets within guide_table_size.
+  [[nodiscard]] static int GuideShift(const Weight total_weight,
+                                      const std::size_t guide_table_size) {
+    const auto total = static_cast<UnsignedWeight>(total_weight);
+    int shift = 0;
+    while (shift + 1 < std::numeric_limits<UnsignedWeight>::digits &&
+           std::cmp_greater(((total - 1) >> shift) + 1, guide_table_size)) {
+      ++shift;
+    }
+    return shift;
+  }
+
+  // Returns the number of buckets for a total weight and bucket width.
+  [[nodiscard]] static std::size_t GuideBuckets(const Weight total_weight,
+                                                const int shift) {
+    return static_cast<std::size_t>(
+        ((static_cast<UnsignedWeight>(total_weight) - 1) >> shift) + 1);
+  }
+
+  // Rebuilds the guide or dense lookup table, as options selects, for the
+  // current thresholds. Existing capacity is reused.
+  void BuildLookups(const DynamicProbabilityTableOptions& options) {
+    guide_.clear();
+    guide_shift_ = 0;
+    dense_.clear();
+    if (UsesDenseLookup(GetTotalWeight(), thresholds_.size(), options)) {
+      BuildDense();
+    } else if (options.guide_table_size > 0) {
+      BuildGuide(options.guide_table_size);
+    }
+  }
+
+  // Builds the guide table with a single pass over the thresholds.
+  void BuildGuide(const std::size_t guide_table_size) {
+    // use the smallest power-of-two bucket width that fits in the budget
+    guide_shift_ = GuideShift(GetTotalWeight(), guide_table_size);
+    const std::size_t number_of_buckets =
+        GuideBuckets(GetTotalWeight(), guide_shift_);
+    guide_.reserve(number_of_buckets + 1);
+    std::size_t index = 0;
+    for (std::size_t bucket = 0; bucket < number_of_buckets; ++bucket) {
+      // the smallest roll in the bucket
+      const auto first_roll = static_cast<UnsignedWeight>(
+          (static_cast<UnsignedWeight>(bucket) << guide_shift_) + 1);
+      while (static_cast<UnsignedWeight>(thresholds_[index]) < first_roll) {
+        ++index;
+      }
+      guide_.push_back(static_cast<int>(index));
+    }
+    guide_.push_back(static_cast<int>(thresholds_.size() - 1));
+  }
+
+  // Builds the dense lookup table by walking the thresholds once.
+  void BuildDense() {
+    const Weight total_weight = GetTotalWeight();
+    dense_.reserve(static_cast<std::size_t>(total_weight) + 2);
+    // rolls at or below zero select the first outcome
+    dense_.push_back(0);
+    std::size_t index = 0;
+    // count in std::size_t, which cannot wrap at the largest total weight
+    const auto last_roll = static_cast<std::size_t>(total_weight);
+    for (std::size_t roll = 1; roll <= last_roll; ++roll) {
+      while (std::cmp_less(thresholds_[index], roll)) {
+        ++index;
+      }
+      dense_.push_back(static_cast<std::uint16_t>(index));
+    }
+    // rolls above the total weight select the last outcome
+    dense_.push_back(static_cast<std::uint16_t>(thresholds_.size() - 1));
+  }
+
+  // Returns the slot of roll in the dense lookup table.
   //
-  [[nodiscard]] static std::optional<game_dice_cpp::DynamicProbabilityTable>
-  Make(const std::span<const int> weights) {
-    // create a view that sees only non-negative weights
-    auto safe_weights = weights | std::ranges::views::transform([](int weight) {
-                          return std::max(weight, 0);
-                        });
-    // accumulate with check-as-you-go
-    // use std::optional<int> to carry the valid state through the loop
-    std::optional<int> total_weight = std::accumulate(
-        safe_weights.begin(), safe_weights.end(), std::optional<int>(0),
-        [](std::optional<int> accumulated, int weight) -> std::optional<int> {
-          // if a previous step failed...
-          if (!accumulated) {
-            return std::nullopt;
-          }
-          // check for overflow before it happens
-          if (weight > std::numeric_limits<int>::max() - *accumulated) {
-            return std::nullopt;
-          }
-          return *accumulated + weight;
-        });
-    // validation
-    if (!total_weight.has_value() || *total_weight <= 0) {
-      return std::nullopt;
+  // The clamp runs in a type at least as wide as std::int64_t, so the slot
+  // above the total weight never wraps or promotes away from Weight.
+  [[nodiscard]] std::size_t DenseSlot(Weight roll) const {
+    using WideWeight = std::common_type_t<Weight, std::int64_t>;
+    return static_cast<std::size_t>(
+        std::clamp(static_cast<WideWeight>(roll), WideWeight{0},
+                   static_cast<WideWeight>(GetTotalWeight()) + 1));
+  }
+
+  // Validates, clamps and sums the weights in a single pass.
+  template <typename Weights>
+  [[nodiscard]] static std::optional<
+      game_dice_cpp::BasicDynamicProbabilityTable<Weight, Allocator>>
+  MakeFromRange(Weights&& weights,
+                const DynamicProbabilityTableOptions& options,
+                const Allocator& allocator) {
+    std::vector<Weight, Allocator> calculated_thresholds(allocator);
+    Weight total_weight = 0;
+    if constexpr (std::ranges::contiguous_range<Weights> &&
+                  std::ranges::sized_range<Weights>) {
+      // weights in memory can use the vectorized scan
+      const std::span<const Weight> contiguous_weights(weights);
+      calculated_thresholds.resize(contiguous_weights.size());
+      const std::optional<Weight> scanned_total = ParallelClampedPrefixSum(
+          contiguous_weights, std::span<Weight>(calculated_thresholds),
+          options.build_threads, allocator);
+      if (!scanned_total.has_value()) {
+        return std::nullopt;
+      }
+      total_weight = *scanned_total;
+    } else {
+      // pre-allocate storage when the number of weights is known
+      if constexpr (std::ranges::sized_range<Weights>) {
+        calculated_thresholds.reserve(
+            static_cast<std::size_t>(std::ranges::size(weights)));
+      }
+      for (const Weight weight : weights) {
+        const Weight safe_weight = ClampWeight(weight);
+        // check for overflow before it happens
+        if (safe_weight > std::numeric_limits<Weight>::max() - total_weight) {
+          return std::nullopt;
+        }
+        total_weight += safe_weight;
+        calculated_thresholds.push_back(total_weight);
+      }
     }
-    // pre-allocate storage
-    std::vector<int> calculated_thresholds;
-    calculated_thresholds.reserve(weights.size());
-    std::partial_sum(safe_weights.begin(), safe_weights.end(),
-                     std::back_inserter(calculated_thresholds));
     // check if the thresholds do not exist or sum to nothing
-    if (calculated_thresholds.empty() || calculated_thresholds.back() <= 0) {
+    if (calculated_thresholds.empty() || total_weight <= 0) {
       return std::nullopt;
     }
     // construct and return
-    return DynamicProbabilityTable(std::move(calculated_thresholds));
+    BasicDynamicProbabilityTable table(std::move(calculated_thresholds));
+    table.BuildLookups(options);
+    return table;
+  }
+
+ public:
+  // Every allocation made by the table, including the optional lookup
+  // structures, comes from allocator.
+  [[nodiscard]] static std::optional<
+      game_dice_cpp::BasicDynamicProbabilityTable<Weight, Allocator>>
+  Make(const std::span<const Weight> weights,
+       const DynamicProbabilityTableOptions& options = {},
+       const Allocator& allocator = Allocator()) {
+    return MakeFromRange(weights, options, allocator);
+  }
+
+  // Builds a table from any input range of weights, such as a stream.
+  //
+  // The weights are read exactly once, so nothing needs to be collected into
+  // a container first.
+  template <std::ranges::input_range Weights>
+    requires std::same_as<std::ranges::range_value_t<Weights>, Weight>
+  [[nodiscard]] static std::optional<
+      game_dice_cpp::BasicDynamicProbabilityTable<Weight, Allocator>>
+  Make(Weights&& weights, const DynamicProbabilityTableOptions& options = {},
+       const Allocator& allocator = Allocator()) {
+    return MakeFromRange(std::forward<Weights>(weights), options, allocator);
   }
+  // Replaces the weights of the table, reusing its storage.
+  //
+  // The result is the same as assigning Make(weights, options), but the
+  // thresholds and lookup tables are rewritten in place, so a rebuild that
+  // fits in the current capacity does not allocate.
+  //
+  // Returns false and leaves the table unchanged if the weights fail the
+  // validation of Make. All storage is reserved before anything is written, so
+  // if growing it throws, the table is also unchanged. The scan always runs on
+  // the calling thread.
+  [[nodiscard]] bool Rebuild(
+      const std::span<const Weight> weights,
+      const DynamicProbabilityTableOptions& options = {}) {
+    // validate before changing anything
+    const std::optional<Weight> total_weight = ClampedSum(weights);
+    if (weights.empty() || !total_weight.has_value() || *total_weight <= 0) {
+      return false;
+    }
+    // reserve all of the storage up front, so nothing below can throw
+    thresholds_.reserve(weights.size());
+    if (UsesDenseLookup(*total_weight, weights.size(), options)) {
+      dense_.reserve(static_cast<std::size_t>(*total_weight) + 2);
+    } else if (options.guide_table_size > 0) {
+      guide_.reserve(GuideBuckets(
+                         *total_weight,
+                         GuideShift(*total_weight, options.guide_table_size)) +
+                     1);
+    }
+    thresholds_.resize(weights.size());
+    // the weights are valid, so the scan cannot fail
+    static_cast<void>(
+        ClampedPrefixSum(weights, std::span<Weight>(thresholds_)));
+    BuildLookups(options);
+    return true;
+  }
+
   // Returns the exact die size required to drive this table.
-  [[nodiscard]] int GetTotalWeight() const { return thresholds_.back(); }
+  [[nodiscard]] Weight GetTotalWeight() const { return thresholds_.back(); }
+
+  // Returns true when lookups use the dense lookup table.
+  [[nodiscard]] bool HasDenseLookup() const { return !dense_.empty(); }
 
   // Maps a value (example: from a die roll) to an outcome index.
-  [[nodiscard]] int GetOutcomeIndex(int roll) const {
+  [[nodiscard]] int GetOutcomeIndex(Weight roll) const {
+    if (!dense_.empty()) {
+      // clamp value within range of table
+      return dense_[DenseSlot(roll)];
+    }
+    if (!guide_.empty() && roll > 0 && roll <= GetTotalWeight()) {
+      // only search the thresholds that can hold a roll from this bucket
+      const auto bucket = static_cast<std::size_t>(
+          static_cast<UnsignedWeight>(roll - 1) >> guide_shift_);
+      const auto first = thresholds_.begin() + guide_[bucket];
+      const auto last = thresholds_.begin() + guide_[bucket + 1] + 1;
+      return static_cast<int>(
+          std::distance(thresholds_.begin(), std::lower_bound(first, last, roll)));
+    }
     // binary search for the value
     const auto iter = std::ranges::lower_bound(thresholds_, roll);
     // clamp value within range of table
@@ -111,7 +358,56 @@ class DynamicProbabilityTable {
     }
     return static_cast<int>(std::distance(thresholds_.begin(), iter));
   }
+
+  // Maps a batch of values to outcome indexes.
+  //
+  // This gives the same results as calling GetOutcomeIndex on every roll, but
+  // interleaves the searches so that their memory latency overlaps.
+  // Only the first min(rolls.size(), out_indexes.size()) rolls are mapped.
+  void GetOutcomeIndexes(const std::span<const Weight> rolls,
+                         const std::span<int> out_indexes) const {
+    if (!dense_.empty() || !guide_.empty()) {
+      // the lookup tables already remove most of the search
+      const std::size_t count = std::min(rolls.size(), out_indexes.size());
+      for (std::size_t i = 0; i < count; ++i) {
+        out_indexes[i] = GetOutcomeIndex(rolls[i]);
+      }
+      return;
+    }
+    InterleavedLowerBound<Weight>(thresholds_, rolls, out_indexes);
+  }
+
+  // Selects up to k distinct outcome indexes by weight, in draw order.
+  //
+  // This is the same as drawing k times and removing each drawn outcome, but
+  // without rebuilding the table. Outcomes with zero weight are never selected,
+  // so fewer than k indexes are returned when fewer outcomes have weight.
+  //
+  // engine: A C++ STL compatible random number engine
+  template <typename Engine>
+  [[nodiscard]] std::vector<int> SampleDistinct(std::size_t k,
+                                                Engine& engine) const {
+    return SampleDistinctOutcomes<Weight>(
+        thresholds_, [this](Weight roll) { return GetOutcomeIndex(roll); }, k,
+        engine);
+  }
 };
+
+// The default table, with int weights.
+using DynamicProbabilityTable = BasicDynamicProbabilityTable<int>;
+
+namespace pmr {
+// Tables that allocate from a std::pmr::memory_resource.
+//
+// Pass the resource as the allocator argument of Make, example:
+//   std::pmr::monotonic_buffer_resource arena;
+//   auto table = pmr::DynamicProbabilityTable::Make(weights, {}, &arena);
+template <CountingInteger Weight>
+using BasicDynamicProbabilityTable =
+    game_dice_cpp::BasicDynamicProbabilityTable<
+        Weight, std::pmr::polymorphic_allocator<Weight>>;
+using DynamicProbabilityTable = BasicDynamicProbabilityTable<int>;
+}  // namespace pmr
 }  // namespace game_dice_cpp
 
 #endif  // GAME_DICE_CPP_SRC_DYNAMICPROBABILITYTABLE_H
@@ -0,0 +1,121 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_DYNAMICPROBABILITYTABLEVIEW_H
+#define GAME_DICE_CPP_SRC_DYNAMICPROBABILITYTABLEVIEW_H
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "./BatchSearch.h"
+#include "./IntegerConcepts.h"
+
+namespace game_dice_cpp {
+// A non-owning view that maps a linear range [1, N] to a set of weight indexes.
+//
+// The view reads cumulative thresholds (the running sum of the weights) from a
+// buffer that someone else owns, such as shared memory or an asset blob. It
+// never copies or allocates, and it is only valid while that buffer is alive.
+//
+// You should choose DynamicProbabilityTableView over DynamicProbabilityTable
+// when the thresholds are precomputed and already live in memory.
+template <CountingInteger Weight>
+class BasicDynamicProbabilityTableView {
+ private:
+  // Cumulative upper bounds.
+  std::span<const Weight> thresholds_;
+
+  explicit constexpr BasicDynamicProbabilityTableView(
+      const std::span<const Weight> thresholds)
+      : thresholds_(thresholds) {}
+
+ public:
+  // Views a buffer of cumulative thresholds after checking it in O(n).
+  //
+  // Returns std::nullopt unless the thresholds are non-empty, start at zero or
+  // more, never decrease and end above zero. These are exactly the thresholds
+  // that DynamicProbabilityTable::Make can produce.
+  [[nodiscard]] static constexpr std::optional<
+      game_dice_cpp::BasicDynamicProbabilityTableView<Weight>>
+  Make(const std::span<const Weight> thresholds) {
+    // validation
+    if (thresholds.empty() || std::cmp_less(thresholds.front(), 0) ||
+        thresholds.back() <= 0 || !std::ranges::is_sorted(thresholds)) {
+      return std::nullopt;
+    }
+    return BasicDynamicProbabilityTableView(thresholds);
+  }
+
+  // Views a buffer of cumulative thresholds without checking it.
+  //
+  // Use this for buffers that have already been checked, for example when
+  // they were written by this library. The thresholds must meet the same
+  // conditions as Make, otherwise the lookups are meaningless.
+  [[nodiscard]] static constexpr BasicDynamicProbabilityTableView MakeTrusted(
+      const std::span<const Weight> thresholds) {
+    return BasicDynamicProbabilityTableView(thresholds);
+  }
+
+  // Returns the exact die size required to drive this table.
+  [[nodiscard]] constexpr Weight GetTotalWeight() const {
+    return thresholds_.back();
+  }
+
+  // Returns the viewed thresholds.
+  [[nodiscard]] constexpr std::span<const Weight> GetThresholds() const {
+    return thresholds_;
+  }
+
+  // Maps a value (example: from a die roll) to an outcome index.
+  //
+  // This gives the same result as DynamicProbabilityTable::GetOutcomeIndex for
+  // the same thresholds.
+  [[nodiscard]] constexpr int GetOutcomeIndex(Weight roll) const {
+    // binary search for the value
+    const auto iter = std::ranges::lower_bound(thresholds_, roll);
+    // clamp value within range of table
+    if (iter == thresholds_.end()) {
+      // this case happens when the input value is greater than the total_weight
+      return static_cast<int>(thresholds_.size() - 1);
+    }
+    return static_cast<int>(std::distance(thresholds_.begin(), iter));
+  }
+
+  // Maps a batch of values to outcome indexes.
+  //
+  // Only the first min(rolls.size(), out_indexes.size()) rolls are mapped.
+  constexpr void GetOutcomeIndexes(const std::span<const Weight> rolls,
+                                   const std::span<int> out_indexes) const {
+    InterleavedLowerBound<Weight>(thresholds_, rolls, out_indexes);
+  }
+};
+
+// The default view, with int thresholds.
+using DynamicProbabilityTableView = BasicDynamicProbabilityTableView<int>;
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_DYNAMICPROBABILITYTABLEVIEW_H
@@ -0,0 +1,145 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_EYTZINGERPROBABILITYTABLE_H
+#define GAME_DICE_CPP_SRC_EYTZINGERPROBABILITYTABLE_H
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+// A data structure that maps a linear range [1, N] to a set of weight indexes.
+//
+// This stores the same cumulative thresholds as DynamicProbabilityTable, but
+// in Eytzinger (breadth-first) order: the children of node k live at 2k and
+// 2k + 1. The top levels of the implicit tree share a handful of cache lines,
+// and the descent is branchless, so the only stalls left are the memory loads
+// themselves. Those are hidden by prefetching the grandchildren of the node
+// being compared.
+//
+// You should choose EytzingerProbabilityTable over DynamicProbabilityTable when
+// the thresholds no longer fit in the L1 cache.
+class EytzingerProbabilityTable {
+ private:
+  // Cumulative upper bounds in Eytzinger order.
+  // Index 0 is unused so that the children of node k are 2k and 2k + 1.
+  std::vector<int> layout_;
+  // Maps a node of the layout back to its outcome index.
+  std::vector<int> outcome_indexes_;
+  // The sum of all (non-negative) input weights.
+  int total_weight_;
+
+  explicit EytzingerProbabilityTable(std::vector<int>&& layout,
+                                     std::vector<int>&& outcome_indexes,
+                                     int total_weight)
+      : layout_(std::move(layout)),
+        outcome_indexes_(std::move(outcome_indexes)),
+        total_weight_(total_weight) {}
+
+  // Writes the sorted thresholds into the layout with an in-order walk of the
+  // implicit tree rooted at node.
+  static void FillLayout(const std::span<const int> sorted_thresholds,
+                         std::size_t node, std::size_t& next_sorted,
+                         std::vector<int>& layout,
+                         std::vector<int>& outcome_indexes) {
+    if (node >= layout.size()) {
+      return;
+    }
+    FillLayout(sorted_thresholds, 2 * node, next_sorted, layout,
+               outcome_indexes);
+    layout[node] = sorted_thresholds[next_sorted];
+    outcome_indexes[node] = static_cast<int>(next_sorted);
+    ++next_sorted;
+    FillLayout(sorted_thresholds, (2 * node) + 1, next_sorted, layout,
+               outcome_indexes);
+  }
+
+  // Hints to the CPU that the value at address will be read soon.
+  static void Prefetch(const int* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    static_cast<void>(address);
+#endif
+  }
+
+ public:
+  //
+  [[nodiscard]] static std::optional<game_dice_cpp::EytzingerProbabilityTable>
+  Make(const std::span<const int> weights) {
+    // validation
+    const std::optional<int> total_weight = SumWeights(weights);
+    if (!total_weight.has_value()) {
+      return std::nullopt;
+    }
+    // calculate thresholds in sorted order
+    auto safe_weights = weights | std::ranges::views::transform(ClampWeight);
+    std::vector<int> sorted_thresholds(weights.size());
+    std::partial_sum(safe_weights.begin(), safe_weights.end(),
+                     sorted_thresholds.begin());
+    // permute the thresholds into breadth-first order
+    std::vector<int> layout(weights.size() + 1, 0);
+    std::vector<int> outcome_indexes(weights.size() + 1, 0);
+    std::size_t next_sorted = 0;
+    FillLayout(sorted_thresholds, 1, next_sorted, layout, outcome_indexes);
+    // construct and return
+    return EytzingerProbabilityTable(std::move(layout),
+                                     std::move(outcome_indexes), *total_weight);
+  }
+  // Returns the exact die size required to drive this table.
+  [[nodiscard]] int GetTotalWeight() const { return total_weight_; }
+
+  // Maps a value (example: from a die roll) to an outcome index.
+  [[nodiscard]] int GetOutcomeIndex(int roll) const {
+    const std::size_t number_of_outcomes = layout_.size() - 1;
+    const int* layout = layout_.data();
+    // branchless descent: go right whenever the node is below the roll
+    std::size_t node = 1;
+    while (node <= number_of_outcomes) {
+      // the four grandchildren are contiguous, so one prefetch covers them
+      Prefetch(layout + std::min(4 * node, number_of_outcomes));
+      node = (2 * node) + static_cast<std::size_t>(layout[node] < roll);
+    }
+    // undo the trailing right turns to recover the lower bound
+    node >>= std::countr_one(node) + 1;
+    // clamp value within range of table
+    if (node == 0) {
+      // this case happens when the input value is greater than the total_weight
+      return static_cast<int>(number_of_outcomes - 1);
+    }
+    return outcome_indexes_[node];
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_EYTZINGERPROBABILITYTABLE_H
@@ -0,0 +1,144 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_FENWICKPROBABILITYTABLE_H
+#define GAME_DICE_CPP_SRC_FENWICKPROBABILITYTABLE_H
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./FenwickTree.h"
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+// A mutable data structure that maps a linear range [1, N] to a set of weight
+// indexes.
+//
+// The weights are stored in a Fenwick (binary indexed) tree, so a single weight
+// can change in O(log n) and a lookup descends the tree in O(log n).
+//
+// You should choose FenwickProbabilityTable over DynamicProbabilityTable when
+// weights change between lookups, such as buffs or depletion applied every
+// tick. Rebuilding a DynamicProbabilityTable costs O(n) and an allocation.
+class FenwickProbabilityTable {
+ private:
+  // The (non-negative) weight of every outcome.
+  std::vector<int> weights_;
+  // The Fenwick tree over the weights.
+  FenwickTree tree_;
+  // The sum of all weights.
+  int total_weight_;
+
+  explicit FenwickProbabilityTable(std::vector<int>&& weights, int total_weight)
+      : weights_(std::move(weights)),
+        tree_(weights_),
+        total_weight_(total_weight) {}
+
+ public:
+  //
+  [[nodiscard]] static std::optional<game_dice_cpp::FenwickProbabilityTable>
+  Make(const std::span<const int> weights) {
+    // validation
+    const std::optional<int> total_weight = SumWeights(weights);
+    if (!total_weight.has_value()) {
+      return std::nullopt;
+    }
+    std::vector<int> safe_weights(weights.size());
+    std::ranges::transform(weights, safe_weights.begin(), ClampWeight);
+    return FenwickProbabilityTable(std::move(safe_weights), *total_weight);
+  }
+  // Returns the exact die size required to drive this table.
+  [[nodiscard]] int GetTotalWeight() const { return total_weight_; }
+
+  // Returns the number of outcomes in the table.
+  [[nodiscard]] std::size_t GetNumberOfOutcomes() const {
+    return weights_.size();
+  }
+
+  // Returns the (non-negative) weight of an outcome.
+  [[nodiscard]] int GetWeight(std::size_t index) const {
+    return weights_[index];
+  }
+
+  // Replaces the weight of an outcome in O(log n).
+  //
+  // Negative weights are treated as zero, as in Make.
+  //
+  // Returns false, and leaves the table unchanged, if index is out of range or
+  // the new total weight would overflow an int or not be positive.
+  [[nodiscard]] bool SetWeight(std::size_t index, int weight) {
+    if (index >= weights_.size()) {
+      return false;
+    }
+    const int safe_weight = ClampWeight(weight);
+    // check for overflow before it happens
+    const std::int64_t new_total = std::int64_t{total_weight_} -
+                                   weights_[index] + std::int64_t{safe_weight};
+    if (new_total <= 0 || new_total > std::numeric_limits<int>::max()) {
+      return false;
+    }
+    tree_.Add(index, safe_weight - weights_[index]);
+    weights_[index] = safe_weight;
+    total_weight_ = static_cast<int>(new_total);
+    return true;
+  }
+
+  // Adds delta to the weight of an outcome in O(log n).
+  //
+  // A weight that would drop below zero becomes zero.
+  //
+  // Returns false, and leaves the table unchanged, under the same conditions
+  // as SetWeight, or if the new weight would overflow an int.
+  [[nodiscard]] bool AddWeight(std::size_t index, int delta) {
+    if (index >= weights_.size()) {
+      return false;
+    }
+    const std::int64_t weight = std::int64_t{weights_[index]} + delta;
+    // reject rather than clamp, so that no part of delta is dropped
+    if (weight > std::numeric_limits<int>::max()) {
+      return false;
+    }
+    return SetWeight(index,
+                     static_cast<int>(std::max<std::int64_t>(weight, 0)));
+  }
+
+  // Maps a value (example: from a die roll) to an outcome index.
+  //
+  // This gives the same result as DynamicProbabilityTable::GetOutcomeIndex for
+  // the same weights.
+  [[nodiscard]] int GetOutcomeIndex(int roll) const {
+    const std::size_t position = tree_.Find(roll);
+    // clamp value within range of table
+    return static_cast<int>(std::min(position, weights_.size() - 1));
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_FENWICKPROBABILITYTABLE_H
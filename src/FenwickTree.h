@@ -0,0 +1,87 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_FENWICKTREE_H
+#define GAME_DICE_CPP_SRC_FENWICKTREE_H
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace game_dice_cpp {
+// A Fenwick (binary indexed) tree of non-negative int weights.
+//
+// This is the storage shared by FenwickProbabilityTable and WeightedDeck. It
+// does no validation: the caller keeps every weight non-negative and every
+// prefix sum within an int.
+class FenwickTree {
+ private:
+  // The tree, 1-indexed. Node i holds the sum of the weights in
+  // (i - lowbit(i), i].
+  std::vector<int> tree_;
+
+ public:
+  // Builds the tree in O(n) by pushing every node into its parent.
+  explicit FenwickTree(const std::span<const int> weights)
+      : tree_(weights.size() + 1, 0) {
+    for (std::size_t node = 1; node < tree_.size(); ++node) {
+      tree_[node] += weights[node - 1];
+      const std::size_t parent = node + (node & (~node + 1));
+      if (parent < tree_.size()) {
+        tree_[parent] += tree_[node];
+      }
+    }
+  }
+
+  // Adds delta to the weight at index in O(log n).
+  void Add(const std::size_t index, const int delta) {
+    for (std::size_t node = index + 1; node < tree_.size();
+         node += node & (~node + 1)) {
+      tree_[node] += delta;
+    }
+  }
+
+  // Returns the index of the weight that holds roll, in O(log n).
+  //
+  // This is the number of weights whose prefix sum is below roll, so rolls
+  // above the total weight return the number of weights.
+  [[nodiscard]] std::size_t Find(const int roll) const {
+    // descend the tree to the last node whose prefix sum is below the roll
+    std::size_t position = 0;
+    int remaining = roll;
+    for (std::size_t step = std::bit_floor(tree_.size() - 1); step > 0;
+         step >>= 1) {
+      const std::size_t next = position + step;
+      if (next < tree_.size() && tree_[next] < remaining) {
+        position = next;
+        remaining -= tree_[next];
+      }
+    }
+    return position;
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_FENWICKTREE_H
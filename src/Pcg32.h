@@ -0,0 +1,119 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_PCG32_H
+#define GAME_DICE_CPP_SRC_PCG32_H
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace game_dice_cpp {
+
+// A 32-bit random number engine with two words of state.
+//
+// This is pcg32 (PCG-XSH-RR): a 64-bit linear congruential generator whose
+// high bits are scrambled by a data-dependent rotation. The second word picks
+// one of 2^63 independent streams, so entities that share a seed can still be
+// given unrelated rolls. Jumping ahead by n values takes O(log n) steps.
+//
+// The output matches the reference implementation for the same seed and
+// sequence.
+//
+// This satisfies std::uniform_random_bit_generator and works with Roll.
+class Pcg32 {
+ public:
+  using result_type = std::uint32_t;
+  static constexpr std::uint64_t default_seed{0x853c'49e6'748f'ea9bU};
+  static constexpr std::uint64_t default_sequence{0x6d1f'1ce5'ca5c'adedU};
+
+ private:
+  static constexpr std::uint64_t multiplier{0x5851'f42d'4c95'7f2dU};
+  // The position in the stream.
+  std::uint64_t state_{0};
+  // The odd increment that selects the stream.
+  std::uint64_t increment_{1};
+
+  // Advances the state by one step.
+  constexpr void Step() { state_ = state_ * multiplier + increment_; }
+
+ public:
+  // Constructs the engine with the default seed and sequence.
+  constexpr Pcg32() : Pcg32(default_seed, default_sequence) {}
+  // Constructs the engine from a seed and a stream selector.
+  //
+  // Every seed and sequence is valid. The top bit of the sequence is ignored.
+  constexpr explicit Pcg32(const std::uint64_t seed,
+                           const std::uint64_t sequence = default_sequence) {
+    this->seed(seed, sequence);
+  }
+
+  // Restarts the stream from a seed and a stream selector.
+  constexpr void seed(const std::uint64_t seed = default_seed,
+                      const std::uint64_t sequence = default_sequence) {
+    state_ = 0;
+    increment_ = (sequence << 1) | 1;
+    Step();
+    state_ += seed;
+    Step();
+  }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Advances the engine and returns the next value.
+  constexpr result_type operator()() {
+    const std::uint64_t old_state = state_;
+    Step();
+    const auto shuffled =
+        static_cast<std::uint32_t>(((old_state >> 18) ^ old_state) >> 27);
+    return std::rotr(shuffled, static_cast<int>(old_state >> 59));
+  }
+
+  // Advances the engine by count values in O(log count) steps.
+  constexpr void discard(unsigned long long count) {
+    // compose the affine step with itself by repeated squaring
+    std::uint64_t total_multiplier = 1;
+    std::uint64_t total_increment = 0;
+    std::uint64_t step_multiplier = multiplier;
+    std::uint64_t step_increment = increment_;
+    for (; count > 0; count >>= 1) {
+      if ((count & 1) != 0) {
+        total_multiplier *= step_multiplier;
+        total_increment = total_increment * step_multiplier + step_increment;
+      }
+      step_increment = (step_multiplier + 1) * step_increment;
+      step_multiplier *= step_multiplier;
+    }
+    state_ = total_multiplier * state_ + total_increment;
+  }
+
+  friend constexpr bool operator==(const Pcg32&, const Pcg32&) = default;
+};
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_PCG32_H
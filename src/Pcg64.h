@@ -0,0 +1,160 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_PCG64_H
+#define GAME_DICE_CPP_SRC_PCG64_H
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+#include "./BoundedRandom.h"
+
+namespace game_dice_cpp {
+
+// A 64-bit random number engine with four words of state.
+//
+// This is pcg64 (PCG-XSL-RR-128/64): a 128-bit linear congruential generator
+// whose two halves are folded together and rotated. Like Pcg32 it has 2^127
+// independent streams and jumps ahead in O(log n) steps. The 128-bit
+// arithmetic is written with MultiplyWide, so it needs no compiler extension.
+//
+// The output matches the reference implementation for the same seed and
+// sequence.
+//
+// This satisfies std::uniform_random_bit_generator and works with Roll.
+class Pcg64 {
+ public:
+  using result_type = std::uint64_t;
+
+  // An unsigned 128-bit value.
+  struct Word {
+    std::uint64_t high;
+    std::uint64_t low;
+
+    friend constexpr bool operator==(const Word&, const Word&) = default;
+  };
+  static constexpr Word default_seed{.high = 0x979c'9a98'd846'2005U,
+                                     .low = 0x7d3e'9cb6'cfe0'549bU};
+  static constexpr Word default_sequence{.high = 0x0000'0000'0000'0001U,
+                                         .low = 0xda3e'39cb'94b9'5bdbU};
+
+ private:
+  static constexpr Word multiplier{.high = 0x2360'ed05'1fc6'5da4U,
+                                   .low = 0x4385'df64'9fcc'f645U};
+  // The position in the stream.
+  Word state_{};
+  // The odd increment that selects the stream.
+  Word increment_{.high = 0, .low = 1};
+
+  // Returns a + b modulo 2^128.
+  [[nodiscard]] static constexpr Word Add(const Word a, const Word b) {
+    const std::uint64_t low = a.low + b.low;
+    return {.high = a.high + b.high + (low < a.low ? 1U : 0U), .low = low};
+  }
+  // Returns a * b modulo 2^128.
+  [[nodiscard]] static constexpr Word Multiply(const Word a, const Word b) {
+    const WideProduct<std::uint64_t> low = MultiplyWide(a.low, b.low);
+    return {.high = low.high + a.high * b.low + a.low * b.high,
+            .low = low.low};
+  }
+  // Advances the state by one step.
+  constexpr void Step() {
+    state_ = Add(Multiply(state_, multiplier), increment_);
+  }
+
+ public:
+  // Constructs the engine with the default seed and sequence.
+  constexpr Pcg64() : Pcg64(default_seed, default_sequence) {}
+  // Constructs the engine from a 64-bit seed, on the default sequence.
+  constexpr explicit Pcg64(const std::uint64_t seed)
+      : Pcg64(Word{.high = 0, .low = seed}) {}
+  // Constructs the engine from a 64-bit seed and stream selector.
+  constexpr explicit Pcg64(const std::uint64_t seed,
+                           const std::uint64_t sequence)
+      : Pcg64(Word{.high = 0, .low = seed}, Word{.high = 0, .low = sequence}) {}
+  // Constructs the engine from a 128-bit seed and stream selector.
+  //
+  // Every seed and sequence is valid. The top bit of the sequence is ignored.
+  constexpr explicit Pcg64(const Word seed,
+                           const Word sequence = default_sequence) {
+    this->seed(seed, sequence);
+  }
+
+  // Restarts the stream from a seed and a stream selector.
+  constexpr void seed(const Word seed = default_seed,
+                      const Word sequence = default_sequence) {
+    state_ = {};
+    increment_ = {.high = (sequence.high << 1) | (sequence.low >> 63),
+                  .low = (sequence.low << 1) | 1};
+    Step();
+    state_ = Add(state_, seed);
+    Step();
+  }
+
+  // Restarts the stream from a 64-bit seed, on the default sequence.
+  constexpr void seed(const std::uint64_t seed) {
+    this->seed(Word{.high = 0, .low = seed});
+  }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Advances the engine and returns the next value.
+  //
+  // Unlike Pcg32, the 128-bit reference scrambles the new state.
+  constexpr result_type operator()() {
+    Step();
+    return std::rotr(state_.high ^ state_.low,
+                     static_cast<int>(state_.high >> 58));
+  }
+
+  // Advances the engine by count values in O(log count) steps.
+  constexpr void discard(unsigned long long count) {
+    // compose the affine step with itself by repeated squaring
+    Word total_multiplier{.high = 0, .low = 1};
+    Word total_increment{};
+    Word step_multiplier = multiplier;
+    Word step_increment = increment_;
+    for (; count > 0; count >>= 1) {
+      if ((count & 1) != 0) {
+        total_multiplier = Multiply(total_multiplier, step_multiplier);
+        total_increment =
+            Add(Multiply(total_increment, step_multiplier), step_increment);
+      }
+      step_increment = Multiply(
+          Add(step_multiplier, Word{.high = 0, .low = 1}), step_increment);
+      step_multiplier = Multiply(step_multiplier, step_multiplier);
+    }
+    state_ = Add(Multiply(total_multiplier, state_), total_increment);
+  }
+
+  friend constexpr bool operator==(const Pcg64&, const Pcg64&) = default;
+};
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_PCG64_H
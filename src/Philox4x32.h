@@ -0,0 +1,246 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_PHILOX4X32_H
+#define GAME_DICE_CPP_SRC_PHILOX4X32_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace game_dice_cpp {
+
+// A counter-based 32-bit random number engine.
+//
+// This is Philox4x32-10 from Salmon et al., "Parallel Random Numbers: As Easy
+// as 1, 2, 3". Each 128-bit counter is encrypted under a 64-bit key by ten
+// rounds of multiply-and-exclusive-or, giving four values. A value depends
+// only on the key and its position, so Block and Seek reach any point of the
+// stream in constant time. That suits rollback, where a simulation step
+// replays from a saved position, and parallel simulation, where every thread
+// or entity owns a disjoint slice of one stream.
+//
+// Counter words 0 and 1 hold the block index, so the engine has 2^66 values
+// per stream. Words 2 and 3 select the stream.
+//
+// This satisfies std::uniform_random_bit_generator and works with Roll.
+class Philox4x32 {
+ public:
+  using result_type = std::uint32_t;
+  using Counter = std::array<std::uint32_t, 4>;
+  using Key = std::array<std::uint32_t, 2>;
+  static constexpr std::uint64_t default_seed{0};
+  // The number of values produced from each counter.
+  static constexpr std::size_t block_size{4};
+
+ private:
+  static constexpr std::uint32_t multiplier_0{0xd251'1f53U};
+  static constexpr std::uint32_t multiplier_1{0xcd9e'8d57U};
+  static constexpr std::uint32_t key_step_0{0x9e37'79b9U};
+  static constexpr std::uint32_t key_step_1{0xbb67'ae85U};
+  static constexpr int rounds{10};
+  // The number of blocks GenerateBlock encrypts side by side.
+  static constexpr std::size_t batch_size{8};
+
+  // The key shared by every block of the stream.
+  Key key_;
+  // The counter of the next block to encrypt.
+  Counter counter_;
+  // The most recently encrypted block.
+  Counter block_{};
+  // The next value of block_ to return, or block_size when it is used up.
+  std::size_t lane_{block_size};
+
+  // Splits a 64-bit value into two counter or key words, low word first.
+  [[nodiscard]] static constexpr std::array<std::uint32_t, 2> Split(
+      const std::uint64_t value) {
+    return {static_cast<std::uint32_t>(value),
+            static_cast<std::uint32_t>(value >> 32)};
+  }
+  // Returns the block index held in counter words 0 and 1.
+  [[nodiscard]] constexpr std::uint64_t GetBlockIndex() const {
+    return (std::uint64_t{counter_[1]} << 32) | counter_[0];
+  }
+  // Moves the counter to a block index, keeping the stream.
+  constexpr void SetBlockIndex(const std::uint64_t index) {
+    const auto words = Split(index);
+    counter_[0] = words[0];
+    counter_[1] = words[1];
+  }
+  // Encrypts the next counter into block_.
+  constexpr void Refill() {
+    block_ = Block(counter_, key_);
+    SetBlockIndex(GetBlockIndex() + 1);
+    lane_ = 0;
+  }
+
+ public:
+  // Constructs the engine with the default seed.
+  constexpr Philox4x32() : Philox4x32(default_seed) {}
+  // Constructs the engine from a seed, which becomes the key, and a stream.
+  //
+  // Every seed and stream is valid.
+  constexpr explicit Philox4x32(const std::uint64_t seed,
+                                const std::uint64_t stream = 0)
+      : key_(Split(seed)), counter_{} {
+    const auto words = Split(stream);
+    counter_[2] = words[0];
+    counter_[3] = words[1];
+  }
+  // Constructs the engine from a key and the counter of its first block.
+  constexpr Philox4x32(const Key& key, const Counter& counter)
+      : key_(key), counter_(counter) {}
+
+  // Restarts the engine at the start of stream 0 for a seed.
+  constexpr void seed(const std::uint64_t seed = default_seed) {
+    *this = Philox4x32(seed);
+  }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Encrypts a single counter under a key.
+  //
+  // This is the whole engine: the values at positions 4i to 4i + 3 of a
+  // stream are Block of the counter with block index i.
+  [[nodiscard]] static constexpr Counter Block(Counter counter, Key key) {
+    for (int round = 0; round < rounds; ++round) {
+      const std::uint64_t product_0 = std::uint64_t{multiplier_0} * counter[0];
+      const std::uint64_t product_1 = std::uint64_t{multiplier_1} * counter[2];
+      counter = {static_cast<std::uint32_t>(product_1 >> 32) ^ counter[1] ^
+                     key[0],
+                 static_cast<std::uint32_t>(product_1),
+                 static_cast<std::uint32_t>(product_0 >> 32) ^ counter[3] ^
+                     key[1],
+                 static_cast<std::uint32_t>(product_0)};
+      key[0] += key_step_0;
+      key[1] += key_step_1;
+    }
+    return counter;
+  }
+
+  // Retrieves the key.
+  [[nodiscard]] constexpr const Key& GetKey() const noexcept { return key_; }
+  // Retrieves the position of the next value in the stream.
+  [[nodiscard]] constexpr std::uint64_t GetPosition() const {
+    return GetBlockIndex() * block_size - (block_size - lane_);
+  }
+  // Moves to a position in the stream in constant time.
+  //
+  // Positions wrap around modulo 2^64, which is a quarter of the stream.
+  constexpr void Seek(const std::uint64_t position) {
+    SetBlockIndex(position / block_size);
+    lane_ = block_size;
+    if (position % block_size != 0) {
+      Refill();
+      lane_ = position % block_size;
+    }
+  }
+
+  // Advances the engine and returns the next value.
+  constexpr result_type operator()() {
+    if (lane_ == block_size) {
+      Refill();
+    }
+    return block_[lane_++];
+  }
+
+  // Advances the engine by count values in constant time.
+  constexpr void discard(const unsigned long long count) {
+    Seek(GetPosition() + count);
+  }
+
+  // Fills values with the next values of the stream.
+  //
+  // The result is the same as calling the engine once per value. Whole blocks
+  // are encrypted batch_size at a time with the rounds interleaved, so the
+  // multiplications of neighbouring counters overlap and can be vectorized.
+  constexpr void GenerateBlock(std::span<result_type> values) {
+    // use up what is left of the current block
+    while (!values.empty() && lane_ != block_size) {
+      values.front() = block_[lane_++];
+      values = values.subspan(1);
+    }
+    // encrypt batches of whole blocks straight into the output
+    const std::uint32_t stream_0 = counter_[2];
+    const std::uint32_t stream_1 = counter_[3];
+    while (values.size() >= batch_size * block_size) {
+      const std::uint64_t first = GetBlockIndex();
+      std::array<std::uint32_t, batch_size> word_0{};
+      std::array<std::uint32_t, batch_size> word_1{};
+      std::array<std::uint32_t, batch_size> word_2{};
+      std::array<std::uint32_t, batch_size> word_3{};
+      for (std::size_t i = 0; i < batch_size; ++i) {
+        const auto index = Split(first + i);
+        word_0[i] = index[0];
+        word_1[i] = index[1];
+        word_2[i] = stream_0;
+        word_3[i] = stream_1;
+      }
+      Key key = key_;
+      for (int round = 0; round < rounds; ++round) {
+        for (std::size_t i = 0; i < batch_size; ++i) {
+          const std::uint64_t product_0 =
+              std::uint64_t{multiplier_0} * word_0[i];
+          const std::uint64_t product_1 =
+              std::uint64_t{multiplier_1} * word_2[i];
+          word_0[i] =
+              static_cast<std::uint32_t>(product_1 >> 32) ^ word_1[i] ^ key[0];
+          word_1[i] = static_cast<std::uint32_t>(product_1);
+          word_2[i] =
+              static_cast<std::uint32_t>(product_0 >> 32) ^ word_3[i] ^ key[1];
+          word_3[i] = static_cast<std::uint32_t>(product_0);
+        }
+        key[0] += key_step_0;
+        key[1] += key_step_1;
+      }
+      for (std::size_t i = 0; i < batch_size; ++i) {
+        values[i * block_size] = word_0[i];
+        values[i * block_size + 1] = word_1[i];
+        values[i * block_size + 2] = word_2[i];
+        values[i * block_size + 3] = word_3[i];
+      }
+      SetBlockIndex(first + batch_size);
+      values = values.subspan(batch_size * block_size);
+    }
+    // finish one block at a time
+    for (result_type& value : values) {
+      value = (*this)();
+    }
+  }
+
+  // Engines are equal when they will produce the same values.
+  friend constexpr bool operator==(const Philox4x32& a, const Philox4x32& b) {
+    return a.key_ == b.key_ && a.counter_ == b.counter_ && a.lane_ == b.lane_ &&
+           (a.lane_ == block_size || a.block_ == b.block_);
+  }
+};
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_PHILOX4X32_H
@@ -0,0 +1,287 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_PREFIXSUM_H
+#define GAME_DICE_CPP_SRC_PREFIXSUM_H
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "./IntegerConcepts.h"
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+
+// Writes the running sum of the clamped weights into thresholds.
+//
+// Negative weights are treated as zero, exactly like SumWeights. thresholds
+// must hold at least weights.size() values.
+//
+// Returns the total weight, or std::nullopt if the sum overflows the weight
+// type. When it returns std::nullopt the contents of thresholds are
+// unspecified. A total of zero is returned as zero, so callers still need to
+// reject it.
+//
+// For int weights outside of constant evaluation, the scan runs 8 (AVX2) or 4
+// (SSE2) lanes at a time. Every partial sum in the scan adds two non-negative
+// values, so the first one to pass the maximum sets its sign bit. The sign
+// bits of every partial sum are collected and checked once at the end, which
+// keeps the loop free of branches.
+template <CountingInteger Weight>
+[[nodiscard]] constexpr std::optional<Weight> ClampedPrefixSum(
+    const std::span<const Weight> weights, const std::span<Weight> thresholds) {
+  const std::size_t count = weights.size();
+  std::size_t offset = 0;
+  Weight total_weight = 0;
+  if constexpr (std::same_as<Weight, int>) {
+    if !consteval {
+#if defined(__AVX2__)
+      __m256i carry_x8 = _mm256_setzero_si256();
+      __m256i signs_x8 = _mm256_setzero_si256();
+      for (; offset + 8 <= count; offset += 8) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        __m256i sums_x8 = _mm256_max_epi32(
+            _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(weights.data() + offset)),
+            _mm256_setzero_si256());
+        // scan within each 128-bit half
+        sums_x8 = _mm256_add_epi32(sums_x8, _mm256_slli_si256(sums_x8, 4));
+        signs_x8 = _mm256_or_si256(signs_x8, sums_x8);
+        sums_x8 = _mm256_add_epi32(sums_x8, _mm256_slli_si256(sums_x8, 8));
+        signs_x8 = _mm256_or_si256(signs_x8, sums_x8);
+        // carry the total of the low half into the high half
+        const __m256i low_total_x8 = _mm256_permute2x128_si256(
+            _mm256_shuffle_epi32(sums_x8, 0xFF), sums_x8, 0x08);
+        sums_x8 = _mm256_add_epi32(sums_x8, low_total_x8);
+        signs_x8 = _mm256_or_si256(signs_x8, sums_x8);
+        // carry the total of every earlier block
+        sums_x8 = _mm256_add_epi32(sums_x8, carry_x8);
+        signs_x8 = _mm256_or_si256(signs_x8, sums_x8);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(thresholds.data() + offset), sums_x8);
+        carry_x8 = _mm256_permutevar8x32_epi32(sums_x8, _mm256_set1_epi32(7));
+      }
+      if (_mm256_movemask_ps(_mm256_castsi256_ps(signs_x8)) != 0) {
+        return std::nullopt;
+      }
+      total_weight = _mm256_cvtsi256_si32(carry_x8);
+#elif defined(__SSE2__)
+      __m128i carry_x4 = _mm_setzero_si128();
+      __m128i signs_x4 = _mm_setzero_si128();
+      for (; offset + 4 <= count; offset += 4) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        __m128i sums_x4 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(weights.data() + offset));
+        // clear negative lanes (SSE2 has no signed 32-bit max)
+        sums_x4 = _mm_andnot_si128(_mm_srai_epi32(sums_x4, 31), sums_x4);
+        sums_x4 = _mm_add_epi32(sums_x4, _mm_slli_si128(sums_x4, 4));
+        signs_x4 = _mm_or_si128(signs_x4, sums_x4);
+        sums_x4 = _mm_add_epi32(sums_x4, _mm_slli_si128(sums_x4, 8));
+        signs_x4 = _mm_or_si128(signs_x4, sums_x4);
+        // carry the total of every earlier block
+        sums_x4 = _mm_add_epi32(sums_x4, carry_x4);
+        signs_x4 = _mm_or_si128(signs_x4, sums_x4);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(thresholds.data() + offset),
+                         sums_x4);
+        carry_x4 = _mm_shuffle_epi32(sums_x4, 0xFF);
+      }
+      if (_mm_movemask_ps(_mm_castsi128_ps(signs_x4)) != 0) {
+        return std::nullopt;
+      }
+      total_weight = _mm_cvtsi128_si32(carry_x4);
+#endif
+    }
+  }
+  // scalar tail (or the whole scan without SIMD support)
+  for (; offset < count; ++offset) {
+    const Weight weight = ClampWeight(weights[offset]);
+    // check for overflow before it happens
+    if (weight > std::numeric_limits<Weight>::max() - total_weight) {
+      return std::nullopt;
+    }
+    total_weight += weight;
+    thresholds[offset] = total_weight;
+  }
+  return total_weight;
+}
+
+// Returns the same total as ClampedPrefixSum without writing any thresholds.
+//
+// Narrow weights are summed in a 64-bit accumulator that cannot overflow within
+// a block, so the inner loop has no branch and vectorizes. Wide weights check
+// for overflow on every step.
+template <CountingInteger Weight>
+[[nodiscard]] constexpr std::optional<Weight> ClampedSum(
+    const std::span<const Weight> weights) {
+  if constexpr (sizeof(Weight) < sizeof(std::int64_t)) {
+    using WideWeight = std::conditional_t<std::is_signed_v<Weight>,
+                                          std::int64_t, std::uint64_t>;
+    // 2^20 weights below 2^32 each stay below 2^52 before the check
+    constexpr std::size_t block_size{std::size_t{1} << 20};
+    WideWeight total_weight = 0;
+    for (std::size_t first = 0; first < weights.size(); first += block_size) {
+      const std::size_t last = std::min(first + block_size, weights.size());
+      for (std::size_t i = first; i < last; ++i) {
+        total_weight += static_cast<WideWeight>(ClampWeight(weights[i]));
+      }
+      if (total_weight >
+          static_cast<WideWeight>(std::numeric_limits<Weight>::max())) {
+        return std::nullopt;
+      }
+    }
+    return static_cast<Weight>(total_weight);
+  } else {
+    Weight total_weight = 0;
+    for (const Weight weight : weights) {
+      const Weight safe_weight = ClampWeight(weight);
+      // check for overflow before it happens
+      if (safe_weight > std::numeric_limits<Weight>::max() - total_weight) {
+        return std::nullopt;
+      }
+      total_weight += safe_weight;
+    }
+    return total_weight;
+  }
+}
+
+// The same scan as ClampedPrefixSum, split across number_of_threads threads.
+//
+// The weights are split into one chunk per thread. Each thread scans its own
+// chunk, the chunk totals are checked and summed on the calling thread, and
+// then each thread adds the total of the earlier chunks to its own chunk.
+// Integer addition is exact, so the thresholds are identical to the serial
+// scan. Zero threads uses std::thread::hardware_concurrency(). Chunks are at
+// least min_chunk_size weights, so small scans stay on the calling thread.
+// If a thread cannot be started, its chunk runs on the calling thread instead,
+// so the scan never throws std::system_error.
+//
+// The per-chunk bookkeeping is allocated from allocator, rebound to each
+// element type. Only the internal state of each std::jthread comes from the
+// global heap.
+template <CountingInteger Weight, typename Allocator = std::allocator<Weight>>
+[[nodiscard]] std::optional<Weight> ParallelClampedPrefixSum(
+    const std::span<const Weight> weights, const std::span<Weight> thresholds,
+    std::size_t number_of_threads, const Allocator& allocator = Allocator()) {
+  using AllocatorTraits = std::allocator_traits<Allocator>;
+  using WorkerAllocator =
+      typename AllocatorTraits::template rebind_alloc<std::jthread>;
+  using TotalAllocator =
+      typename AllocatorTraits::template rebind_alloc<std::optional<Weight>>;
+  using OffsetAllocator =
+      typename AllocatorTraits::template rebind_alloc<Weight>;
+  // below this a thread costs more to start than it saves
+  constexpr std::size_t min_chunk_size{std::size_t{1} << 16};
+  if (number_of_threads == 0) {
+    number_of_threads =
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  }
+  const std::size_t count = weights.size();
+  const std::size_t number_of_chunks =
+      std::min(number_of_threads, count / min_chunk_size);
+  if (number_of_chunks <= 1) {
+    return ClampedPrefixSum(weights, thresholds);
+  }
+  const std::size_t chunk_size =
+      (count + number_of_chunks - 1) / number_of_chunks;
+  // runs task on every chunk, with the first chunk on the calling thread
+  const auto for_each_chunk = [number_of_chunks, &allocator](const auto& task) {
+    std::vector<std::jthread, WorkerAllocator> workers{
+        WorkerAllocator(allocator)};
+    workers.reserve(number_of_chunks - 1);
+    std::size_t next_chunk = 1;
+    try {
+      for (; next_chunk < number_of_chunks; ++next_chunk) {
+        workers.emplace_back(task, next_chunk);
+      }
+    } catch (const std::system_error&) {
+      // out of threads, so the chunks that did not start run below
+    }
+    for (std::size_t chunk = next_chunk; chunk < number_of_chunks; ++chunk) {
+      task(chunk);
+    }
+    task(0);
+    // the workers join when they go out of scope
+  };
+  const auto chunk_weights = [&](std::size_t chunk) {
+    const std::size_t first = std::min(chunk * chunk_size, count);
+    return weights.subspan(first, std::min(chunk_size, count - first));
+  };
+  const auto chunk_thresholds = [&](std::size_t chunk) {
+    const std::size_t first = std::min(chunk * chunk_size, count);
+    return thresholds.subspan(first, std::min(chunk_size, count - first));
+  };
+  // phase one: scan every chunk on its own
+  std::vector<std::optional<Weight>, TotalAllocator> chunk_totals(
+      number_of_chunks, TotalAllocator(allocator));
+  for_each_chunk([&](std::size_t chunk) {
+    chunk_totals[chunk] =
+        ClampedPrefixSum(chunk_weights(chunk), chunk_thresholds(chunk));
+  });
+  // sum the chunk totals, checking for overflow before it happens
+  std::vector<Weight, OffsetAllocator> chunk_offsets(
+      number_of_chunks, OffsetAllocator(allocator));
+  Weight total_weight = 0;
+  for (std::size_t chunk = 0; chunk < number_of_chunks; ++chunk) {
+    if (!chunk_totals[chunk].has_value() ||
+        *chunk_totals[chunk] >
+            std::numeric_limits<Weight>::max() - total_weight) {
+      return std::nullopt;
+    }
+    chunk_offsets[chunk] = total_weight;
+    total_weight += *chunk_totals[chunk];
+  }
+  // phase two: add the total of the earlier chunks to every chunk
+  for_each_chunk([&](std::size_t chunk) {
+    const Weight chunk_offset = chunk_offsets[chunk];
+    if (chunk_offset == 0) {
+      return;
+    }
+    for (Weight& threshold : chunk_thresholds(chunk)) {
+      threshold += chunk_offset;
+    }
+  });
+  return total_weight;
+}
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_PREFIXSUM_H
@@ -0,0 +1,80 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_PREPAREDDICE_H
+#define GAME_DICE_CPP_SRC_PREPAREDDICE_H
+
+#include "./BoundedRandom.h"
+#include "./Dice.h"
+#include "./IntegerConcepts.h"
+
+namespace game_dice_cpp {
+
+// A die paired with the precomputed rejection threshold for rolling it.
+//
+// Rolling a BasicDice computes the threshold only on the rare draws that need
+// it. A BasicPreparedDice pays for it once up front, so every roll is one
+// multiplication and one comparison. Both give the same results for the same
+// engine state.
+template <CountingInteger Sides>
+class BasicPreparedDice {
+ public:
+  // The generator that selects a face in [0, N).
+  using Generator = BoundedUniform<BoundedUniformWord<Sides>>;
+
+ private:
+  // The die this was prepared from.
+  BasicDice<Sides> die_;
+  // Generates a face in [0, N).
+  Generator generator_;
+
+ public:
+  // Prepares a die for rolling.
+  //
+  // die: The die to roll (defines the range [1, N])
+  constexpr explicit BasicPreparedDice(const BasicDice<Sides> die)
+      : die_(die),
+        generator_(static_cast<BoundedUniformWord<Sides>>(die.GetNumSides())) {}
+
+  // Retrieves the die this was prepared from.
+  [[nodiscard]] constexpr BasicDice<Sides> GetDice() const noexcept {
+    return die_;
+  }
+  // Retrieves the number of sides.
+  [[nodiscard]] constexpr Sides GetNumSides() const noexcept {
+    return die_.GetNumSides();
+  }
+  // Retrieves the generator that selects a face in [0, N).
+  [[nodiscard]] constexpr const Generator& GetGenerator() const noexcept {
+    return generator_;
+  }
+};
+
+// The default prepared die, with int faces.
+using PreparedDice = BasicPreparedDice<int>;
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_PREPAREDDICE_H
@@ -0,0 +1,83 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_SPLITMIX64_H
+#define GAME_DICE_CPP_SRC_SPLITMIX64_H
+#include <cstdint>
+#include <limits>
+
+namespace game_dice_cpp {
+
+// A 64-bit random number engine with a single word of state.
+//
+// SplitMix64 adds a fixed odd constant to its state and mixes the result, so
+// every seed, including zero, gives a full-period stream. It is the fastest
+// engine here to seed and is also used to expand a single seed into the state
+// of the larger engines.
+//
+// This satisfies std::uniform_random_bit_generator and works with Roll.
+class SplitMix64 {
+ private:
+  // The position in the stream.
+  std::uint64_t state_;
+
+ public:
+  using result_type = std::uint64_t;
+  static constexpr result_type default_seed{0};
+
+  // Constructs the engine with the default seed.
+  constexpr SplitMix64() : SplitMix64(default_seed) {}
+  // Constructs the engine from a seed. Every seed is valid.
+  constexpr explicit SplitMix64(const result_type seed) : state_(seed) {}
+
+  // Restarts the stream from a seed.
+  constexpr void seed(const result_type seed = default_seed) { state_ = seed; }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Advances the engine and returns the next value.
+  constexpr result_type operator()() {
+    state_ += 0x9e37'79b9'7f4a'7c15U;
+    result_type mixed = state_;
+    mixed = (mixed ^ (mixed >> 30)) * 0xbf58'476d'1ce4'e5b9U;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94d0'49bb'1331'11ebU;
+    return mixed ^ (mixed >> 31);
+  }
+
+  // Advances the engine by count values in constant time.
+  constexpr void discard(const unsigned long long count) {
+    state_ += 0x9e37'79b9'7f4a'7c15U * count;
+  }
+
+  friend constexpr bool operator==(const SplitMix64&,
+                                   const SplitMix64&) = default;
+};
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_SPLITMIX64_H
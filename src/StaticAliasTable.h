@@ -0,0 +1,156 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_STATICALIASTABLE_H
+#define GAME_DICE_CPP_SRC_STATICALIASTABLE_H
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+
+// A compile-time alias table that maps a linear range to a set of weight
+// indexes in constant time.
+//
+// This is the constexpr counterpart of DynamicAliasTable. The probability and
+// alias columns live in std::array, so the table can be built at compile time
+// and sampled without touching the heap.
+template <size_t NumberOfOutcomes>
+class StaticAliasTable {
+ private:
+  // Rolls in a column below its threshold select the column's own outcome.
+  std::array<int, NumberOfOutcomes> thresholds_;
+  // The outcome selected by every other roll in the column.
+  std::array<int, NumberOfOutcomes> aliases_;
+  // The sum of all (non-negative) input weights.
+  int total_weight_;
+
+  constexpr explicit StaticAliasTable(
+      const std::array<int, NumberOfOutcomes>& thresholds,
+      const std::array<int, NumberOfOutcomes>& aliases, int total_weight)
+      : thresholds_(thresholds), aliases_(aliases), total_weight_(total_weight) {}
+
+ public:
+  //
+  [[nodiscard]] static constexpr std::optional<
+      game_dice_cpp::StaticAliasTable<NumberOfOutcomes>>
+  Make(const std::array<int, NumberOfOutcomes>& input_weights) {
+    // validation
+    const std::optional<int> total_weight = SumWeights(input_weights);
+    if (!total_weight.has_value()) {
+      return std::nullopt;
+    }
+    const auto total = static_cast<std::uint64_t>(*total_weight);
+    // scale every weight by the number of outcomes so that the average column
+    // height is exactly total_weight
+    std::array<std::uint64_t, NumberOfOutcomes> scaled_weights{};
+    for (std::size_t i = 0; i < NumberOfOutcomes; ++i) {
+      scaled_weights[i] =
+          static_cast<std::uint64_t>(ClampWeight(input_weights[i])) *
+          NumberOfOutcomes;
+    }
+    // sort the columns into under-full and over-full work lists
+    std::array<int, NumberOfOutcomes> small{};
+    std::array<int, NumberOfOutcomes> large{};
+    std::size_t small_count = 0;
+    std::size_t large_count = 0;
+    for (std::size_t i = 0; i < NumberOfOutcomes; ++i) {
+      if (scaled_weights[i] < total) {
+        small[small_count++] = static_cast<int>(i);
+      } else {
+        large[large_count++] = static_cast<int>(i);
+      }
+    }
+    // every column starts as a full column of its own outcome
+    std::array<int, NumberOfOutcomes> thresholds{};
+    std::array<int, NumberOfOutcomes> aliases{};
+    for (std::size_t i = 0; i < NumberOfOutcomes; ++i) {
+      thresholds[i] = *total_weight;
+      aliases[i] = static_cast<int>(i);
+    }
+    // top up each under-full column with the excess of an over-full one
+    while (small_count > 0 && large_count > 0) {
+      const auto small_index = static_cast<std::size_t>(small[--small_count]);
+      const int large_outcome = large[large_count - 1];
+      const auto large_index = static_cast<std::size_t>(large_outcome);
+      thresholds[small_index] = static_cast<int>(scaled_weights[small_index]);
+      aliases[small_index] = large_outcome;
+      // move the donated height out of the over-full column
+      scaled_weights[large_index] -= total - scaled_weights[small_index];
+      if (scaled_weights[large_index] < total) {
+        --large_count;
+        small[small_count++] = large_outcome;
+      }
+    }
+    // the arithmetic is exact, so any column left in a work list is full
+    return StaticAliasTable(thresholds, aliases, *total_weight);
+  }
+  // Returns the sum of all weights in the table.
+  [[nodiscard]] constexpr int GetTotalWeight() const { return total_weight_; }
+
+  // Returns the exact die size required to drive this table.
+  //
+  // This is GetTotalWeight() multiplied by the number of outcomes.
+  [[nodiscard]] constexpr std::uint64_t GetRollRange() const {
+    return static_cast<std::uint64_t>(total_weight_) * NumberOfOutcomes;
+  }
+
+  // Maps a value in [1, GetRollRange()] to an outcome index.
+  //
+  // Values outside of that range are clamped into it.
+  [[nodiscard]] constexpr int GetOutcomeIndex(std::uint64_t roll) const {
+    // clamp value within range of table
+    const std::uint64_t offset =
+        std::clamp(roll, std::uint64_t{1}, GetRollRange()) - 1;
+    // split the roll into a column and a height within that column
+    const auto total = static_cast<std::uint64_t>(total_weight_);
+    const auto column = static_cast<std::size_t>(offset / total);
+    const auto height = static_cast<int>(offset % total);
+    if (height < thresholds_[column]) {
+      return static_cast<int>(column);
+    }
+    return aliases_[column];
+  }
+
+  // Selects an outcome index using a single draw from the provided engine.
+  //
+  // engine: A C++ STL compatible random number engine
+  template <typename Engine>
+  [[nodiscard]] int Sample(Engine& engine) const {
+    // NOLINTNEXTLINE(misc-const-correctness): STL dists not const-callable
+    std::uniform_int_distribution<std::uint64_t> distribution(1,
+                                                              GetRollRange());
+    return GetOutcomeIndex(distribution(engine));
+  }
+};
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_STATICALIASTABLE_H
@@ -28,72 +28,199 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
-#include <limits>
-#include <numeric>
 #include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "./BatchSearch.h"
+#include "./IntegerConcepts.h"
+#include "./PrefixSum.h"
+#include "./WeightValidation.h"
+#include "./WeightedReservoir.h"
 
 namespace game_dice_cpp {
 
-template <size_t NumberOfOutcomes>
-class StaticProbabilityTable {
+// Weight is the integer type of the weights, thresholds and rolls. Use
+// BasicStaticProbabilityTable<std::uint64_t, N> when the total weight does not
+// fit in an int.
+//
+// DenseMaxWeight is the largest total weight that uses a dense lookup table.
+// A dense lookup table stores the outcome index of every roll, so a lookup is
+// a single load. It is stored inline, so it costs DenseMaxWeight + 2 bytes (or
+// shorts above 256 outcomes) whether it is used or not. Zero disables it.
+template <CountingInteger Weight, size_t NumberOfOutcomes,
+          size_t DenseMaxWeight = 0>
+class BasicStaticProbabilityTable {
  private:
-  std::array<int, NumberOfOutcomes> thresholds_;
+  static_assert(DenseMaxWeight == 0 || NumberOfOutcomes <= 65536,
+                "dense lookup tables hold at most 65536 outcomes");
+  // The smallest type that holds every outcome index.
+  using DenseIndex = std::conditional_t<NumberOfOutcomes <= 256, std::uint8_t,
+                                        std::uint16_t>;
+
+  std::array<Weight, NumberOfOutcomes> thresholds_;
+  // The outcome index of every roll in [0, GetTotalWeight() + 1], when
+  // GetTotalWeight() is at most DenseMaxWeight.
+  [[no_unique_address]] std::array<
+      DenseIndex, (DenseMaxWeight > 0 ? DenseMaxWeight + 2 : 0)> dense_{};
+
+  constexpr explicit BasicStaticProbabilityTable(
+      const std::array<Weight, NumberOfOutcomes>& thresholds)
+      : thresholds_(thresholds) {
+    if constexpr (DenseMaxWeight > 0) {
+      if (UsesDenseLookup()) {
+        FillDense();
+      }
+    }
+  }
+
+  // Returns true when the total weight is small enough for the dense table.
+  [[nodiscard]] constexpr bool UsesDenseLookup() const {
+    return DenseMaxWeight > 0 &&
+           std::cmp_less_equal(GetTotalWeight(), DenseMaxWeight);
+  }
+
+  // Fills the dense lookup table by walking the thresholds once.
+  constexpr void FillDense() {
+    const Weight total_weight = GetTotalWeight();
+    std::size_t index = 0;
+    // count in std::size_t, which cannot wrap at the largest total weight
+    const auto last_roll = static_cast<std::size_t>(total_weight);
+    for (std::size_t roll = 1; roll <= last_roll; ++roll) {
+      while (std::cmp_less(thresholds_[index], roll)) {
+        ++index;
+      }
+      dense_[roll] = static_cast<DenseIndex>(index);
+    }
+    // rolls above the total weight select the last outcome
+    dense_[static_cast<std::size_t>(total_weight) + 1] =
+        static_cast<DenseIndex>(NumberOfOutcomes - 1);
+  }
 
-  constexpr explicit StaticProbabilityTable(
-      const std::array<int, NumberOfOutcomes>& thresholds)
-      : thresholds_(thresholds) {}
+  // Returns the slot of roll in the dense lookup table.
+  //
+  // The clamp runs in a type at least as wide as std::int64_t, so the slot
+  // above the total weight never wraps or promotes away from Weight.
+  [[nodiscard]] constexpr std::size_t DenseSlot(Weight roll) const {
+    using WideWeight = std::common_type_t<Weight, std::int64_t>;
+    return static_cast<std::size_t>(
+        std::clamp(static_cast<WideWeight>(roll), WideWeight{0},
+                   static_cast<WideWeight>(GetTotalWeight()) + 1));
+  }
+
+  // Counts how many thresholds are below roll without branching on the data.
+  //
+  // Because the thresholds are sorted, the count is the lower bound of roll.
+  // The roll is broadcast and compared against 8 (AVX2) or 4 (SSE2) thresholds
+  // at a time. Each comparison yields -1 per matching lane, so subtracting the
+  // masks accumulates per-lane counts that are summed once at the end. This
+  // avoids a popcount per block, which is a library call on baseline x86-64.
+  [[nodiscard]] int CountThresholdsBelow(int roll) const {
+    std::size_t offset = 0;
+    int count = 0;
+    // the number of thresholds left over for the narrower paths
+    [[maybe_unused]] std::size_t remaining = NumberOfOutcomes;
+#if defined(__AVX2__)
+    remaining = NumberOfOutcomes % 8;
+    if constexpr (NumberOfOutcomes >= 8) {
+      const __m256i roll_x8 = _mm256_set1_epi32(roll);
+      __m256i counts_x8 = _mm256_setzero_si256();
+      for (; offset + 8 <= NumberOfOutcomes; offset += 8) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const __m256i thresholds_x8 = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(thresholds_.data() + offset));
+        counts_x8 = _mm256_sub_epi32(
+            counts_x8, _mm256_cmpgt_epi32(roll_x8, thresholds_x8));
+      }
+      // fold the 8 lane counts into 4
+      const __m128i counts_x4 =
+          _mm_add_epi32(_mm256_castsi256_si128(counts_x8),
+                        _mm256_extracti128_si256(counts_x8, 1));
+      count += SumLanes(counts_x4);
+    }
+#endif
+#if defined(__SSE2__)
+    if (remaining >= 4) {
+      const __m128i roll_x4 = _mm_set1_epi32(roll);
+      __m128i counts_x4 = _mm_setzero_si128();
+      for (; offset + 4 <= NumberOfOutcomes; offset += 4) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const __m128i thresholds_x4 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(thresholds_.data() + offset));
+        counts_x4 =
+            _mm_sub_epi32(counts_x4, _mm_cmpgt_epi32(roll_x4, thresholds_x4));
+      }
+      count += SumLanes(counts_x4);
+    }
+#endif
+    // scalar tail (or the whole table without SIMD support)
+    for (; offset < NumberOfOutcomes; ++offset) {
+      count += static_cast<int>(thresholds_[offset] < roll);
+    }
+    return count;
+  }
+
+#if defined(__SSE2__)
+  // Adds the four 32-bit lanes of a vector together.
+  [[nodiscard]] static int SumLanes(__m128i lanes) {
+    lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, 0x4E));
+    lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, 0xB1));
+    return _mm_cvtsi128_si32(lanes);
+  }
+#endif
 
  public:
   //
   [[nodiscard]] static constexpr std::optional<
-      game_dice_cpp::StaticProbabilityTable<NumberOfOutcomes>>
-  Make(const std::array<int, NumberOfOutcomes>& input_weights) {
-    // create a local copy to work with
-    std::array<int, NumberOfOutcomes> weights = input_weights;
-    // transform in-place only non-negative weights
-    std::ranges::transform(weights, weights.begin(),
-                           [](int weight) { return std::max(weight, 0); });
-    // accumulate with check-as-you-go overflow check
-    // use std::optional<int> to carry the valid state through the loop
-    std::optional<int> total_weight = std::accumulate(
-        weights.begin(), weights.end(), std::optional<int>(0),
-        [](std::optional<int> accumulated, int weight) -> std::optional<int> {
-          // if a previous step failed...
-          if (!accumulated) {
-            return std::nullopt;
-          }
-          // check for overflow before it happens
-          if (weight > std::numeric_limits<int>::max() - *accumulated) {
-            return std::nullopt;
-          }
-          return *accumulated + weight;
-        });
-    // validation
-    if (!total_weight.has_value() || *total_weight <= 0) {
-      return std::nullopt;
-    }
-    // calculate thresholds
-    std::array<int, NumberOfOutcomes> thresholds{};
-    std::partial_sum(weights.begin(), weights.end(), thresholds.begin());
+      game_dice_cpp::BasicStaticProbabilityTable<Weight, NumberOfOutcomes,
+                                                 DenseMaxWeight>>
+  Make(const std::array<Weight, NumberOfOutcomes>& input_weights) {
+    // validate, clamp and calculate thresholds in one pass
+    std::array<Weight, NumberOfOutcomes> thresholds{};
+    const std::optional<Weight> total_weight =
+        ClampedPrefixSum<Weight>(input_weights, thresholds);
     // check if the thresholds do not exist or sum to nothing
-    if (thresholds.empty() || thresholds.back() <= 0) {
+    if (!total_weight.has_value() || thresholds.empty() ||
+        *total_weight <= 0) {
       return std::nullopt;
     }
     // construct and return
-    return StaticProbabilityTable(thresholds);
+    return BasicStaticProbabilityTable(thresholds);
   }
-  [[nodiscard]] constexpr int GetTotalWeight() const {
+  [[nodiscard]] constexpr Weight GetTotalWeight() const {
     return thresholds_.back();
   }
-  [[nodiscard]] constexpr int GetOutcomeIndex(int roll) const {
+  [[nodiscard]] constexpr int GetOutcomeIndex(Weight roll) const {
+    if constexpr (DenseMaxWeight > 0) {
+      if (UsesDenseLookup()) {
+        // clamp value within range of table
+        return dense_[DenseSlot(roll)];
+      }
+    }
     // small table optimization
     constexpr std::size_t linear_search_threshold{16};
     if constexpr (NumberOfOutcomes <= linear_search_threshold) {
-      // linear search for the value
+      if constexpr (std::is_same_v<Weight, int>) {
+        if !consteval {
+          // compare against every threshold at once and clamp the count
+          return std::min(CountThresholdsBelow(roll),
+                          static_cast<int>(NumberOfOutcomes) - 1);
+        }
+      }
+      // linear search for the value (compile-time or wide weights)
       const auto iter =
           std::find_if(thresholds_.begin(), thresholds_.end(),
-                       [roll](int threshold) { return threshold >= roll; });
+                       [roll](Weight threshold) { return threshold >= roll; });
       if (iter == thresholds_.end()) {
         return static_cast<int>(thresholds_.size() - 1);
       }
@@ -112,8 +239,47 @@ class StaticProbabilityTable {
       return static_cast<int>(std::distance(thresholds_.begin(), iter));
     }
   }
+
+  // Maps a batch of values to outcome indexes.
+  //
+  // This gives the same results as calling GetOutcomeIndex on every roll. Above
+  // the linear search threshold the binary searches are interleaved so that
+  // their memory latency overlaps.
+  // Only the first min(rolls.size(), out_indexes.size()) rolls are mapped.
+  constexpr void GetOutcomeIndexes(const std::span<const Weight> rolls,
+                                   const std::span<int> out_indexes) const {
+    constexpr std::size_t linear_search_threshold{16};
+    if (NumberOfOutcomes <= linear_search_threshold || UsesDenseLookup()) {
+      const std::size_t count = std::min(rolls.size(), out_indexes.size());
+      for (std::size_t i = 0; i < count; ++i) {
+        out_indexes[i] = GetOutcomeIndex(rolls[i]);
+      }
+    } else {
+      InterleavedLowerBound<Weight>(thresholds_, rolls, out_indexes);
+    }
+  }
+
+  // Selects up to k distinct outcome indexes by weight, in draw order.
+  //
+  // This is the same as drawing k times and removing each drawn outcome.
+  // Outcomes with zero weight are never selected, so fewer than k indexes are
+  // returned when fewer outcomes have weight.
+  //
+  // engine: A C++ STL compatible random number engine
+  template <typename Engine>
+  [[nodiscard]] std::vector<int> SampleDistinct(std::size_t k,
+                                                Engine& engine) const {
+    return SampleDistinctOutcomes<Weight>(
+        thresholds_, [this](Weight roll) { return GetOutcomeIndex(roll); }, k,
+        engine);
+  }
 };
 
+// The default table, with int weights.
+template <size_t NumberOfOutcomes, size_t DenseMaxWeight = 0>
+using StaticProbabilityTable =
+    BasicStaticProbabilityTable<int, NumberOfOutcomes, DenseMaxWeight>;
+
 }  // namespace game_dice_cpp
 
 #endif  // GAME_DICE_CPP_SRC_STATICPROBABILITYTABLE_H
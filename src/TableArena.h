@@ -0,0 +1,140 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_TABLEARENA_H
+#define GAME_DICE_CPP_SRC_TABLEARENA_H
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./DynamicProbabilityTableView.h"
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+// Contiguous storage for many probability tables.
+//
+// The thresholds of every table are packed back to back into one buffer, and a
+// second buffer holds the offset where each table starts (structure of arrays).
+// Building N tables costs two allocations instead of N, and tables that are
+// used together stay close together in memory.
+//
+// You should choose TableArena over many DynamicProbabilityTable objects when
+// a large set of tables is loaded once and kept for the life of the program.
+class TableArena {
+ private:
+  // The cumulative upper bounds of every table, back to back.
+  std::vector<int> thresholds_;
+  // Table i owns thresholds_[offsets_[i], offsets_[i + 1]).
+  std::vector<std::size_t> offsets_;
+
+  TableArena(std::vector<int>&& thresholds, std::vector<std::size_t>&& offsets)
+      : thresholds_(std::move(thresholds)), offsets_(std::move(offsets)) {}
+
+ public:
+  // Builds every table from a range of weight ranges.
+  //
+  // Returns std::nullopt if any table fails the same validation as
+  // DynamicProbabilityTable::Make.
+  template <std::ranges::input_range Tables>
+    requires std::same_as<std::ranges::range_value_t<
+                              std::ranges::range_reference_t<Tables>>,
+                          int>
+  [[nodiscard]] static std::optional<game_dice_cpp::TableArena> Make(
+      const Tables& tables) {
+    std::vector<std::size_t> offsets{0};
+    std::vector<int> thresholds;
+    // size both buffers up front when that only needs the size of each table,
+    // so every weight is still read exactly once
+    if constexpr (std::ranges::sized_range<Tables>) {
+      offsets.reserve(std::ranges::size(tables) + 1);
+      if constexpr (std::ranges::forward_range<Tables> &&
+                    std::ranges::sized_range<
+                        std::ranges::range_reference_t<const Tables&>>) {
+        std::size_t total_size = 0;
+        for (const auto& weights : tables) {
+          total_size += std::ranges::size(weights);
+        }
+        thresholds.reserve(total_size);
+      }
+    }
+    for (const auto& weights : tables) {
+      // validate and build in the same pass
+      int threshold = 0;
+      for (const int weight : weights) {
+        const int safe_weight = ClampWeight(weight);
+        if (safe_weight > std::numeric_limits<int>::max() - threshold) {
+          return std::nullopt;
+        }
+        threshold += safe_weight;
+        thresholds.push_back(threshold);
+      }
+      if (threshold <= 0) {
+        return std::nullopt;
+      }
+      offsets.push_back(thresholds.size());
+    }
+    return TableArena(std::move(thresholds), std::move(offsets));
+  }
+
+  // Returns the number of tables in the arena.
+  [[nodiscard]] std::size_t GetNumberOfTables() const {
+    return offsets_.size() - 1;
+  }
+
+  // Returns a view of table index. The index must be in range.
+  //
+  // The view is valid for as long as the arena.
+  [[nodiscard]] DynamicProbabilityTableView GetTable(std::size_t index) const {
+    // the thresholds were built by Make, so they do not need to be checked
+    return DynamicProbabilityTableView::MakeTrusted(
+        std::span<const int>(thresholds_).subspan(
+            offsets_[index], offsets_[index + 1] - offsets_[index]));
+  }
+
+  // Returns the thresholds of every table, back to back.
+  [[nodiscard]] std::span<const int> GetThresholds() const {
+    return thresholds_;
+  }
+
+  // Returns where each table starts in GetThresholds(), followed by the
+  // number of thresholds.
+  [[nodiscard]] std::span<const std::size_t> GetOffsets() const {
+    return offsets_;
+  }
+
+  // Returns the number of bytes used by the arena, including the object.
+  [[nodiscard]] std::size_t GetMemoryUsage() const {
+    return sizeof(*this) + (thresholds_.capacity() * sizeof(int)) +
+           (offsets_.capacity() * sizeof(std::size_t));
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_TABLEARENA_H
@@ -0,0 +1,474 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_TABLEFILE_H
+#define GAME_DICE_CPP_SRC_TABLEFILE_H
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GAME_DICE_CPP_HAS_MMAP 1
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "./DynamicProbabilityTableView.h"
+#include "./TableArena.h"
+
+namespace game_dice_cpp {
+// The header at the start of every table file.
+//
+// A table file stores finished thresholds so that they can be used straight
+// from the file. The layout, in native byte order, is:
+// - this header
+// - table_count + 1 offsets (std::uint64_t), where table i owns thresholds
+//   [offsets[i], offsets[i + 1])
+// - threshold_count thresholds (std::int32_t)
+//
+// Every section starts on an 8-byte boundary of the file.
+struct TableFileHeader {
+  // The magic bytes that identify a table file.
+  static constexpr std::array<char, 8> expected_magic{'G', 'D', 'C', 'T',
+                                                      'A', 'B', 'L', 'E'};
+  // The version of the layout described above.
+  static constexpr std::uint32_t current_version{1};
+  // Written in native byte order, so a file from a machine of the other
+  // endianness reads back as a different value.
+  static constexpr std::uint32_t expected_byte_order{0x01020304};
+
+  std::array<char, 8> magic{expected_magic};
+  std::uint32_t version{current_version};
+  std::uint32_t byte_order{expected_byte_order};
+  std::uint64_t table_count{0};
+  std::uint64_t threshold_count{0};
+  // A Fletcher-64 checksum of everything after the header.
+  std::uint64_t checksum{0};
+};
+static_assert(sizeof(TableFileHeader) == 40);
+static_assert(sizeof(int) == sizeof(std::int32_t));
+
+// Accumulates a Fletcher-64 checksum over 32-bit words, a block at a time.
+//
+// This lets the loader check each block of thresholds while it is summed.
+class TableFileChecksummer {
+ public:
+  // The most words that are summed before the sums are reduced.
+  static constexpr std::size_t words_per_block{256};
+
+ private:
+  static constexpr std::uint64_t modulus{0xFFFFFFFF};
+
+  std::uint64_t sum_1_{0};
+  std::uint64_t sum_2_{0};
+  // The number of words added since the sums were last reduced.
+  std::size_t unreduced_words_{0};
+
+  // Reduces the sums once a block of words has been added.
+  void FinishWords(const std::size_t count) {
+    // the sums cannot overflow within a block, so only reduce between blocks
+    unreduced_words_ += count;
+    if (unreduced_words_ >= words_per_block) {
+      sum_1_ %= modulus;
+      sum_2_ %= modulus;
+      unreduced_words_ = 0;
+    }
+  }
+
+ public:
+  // Adds at most words_per_block thresholds, and returns how many of them are
+  // less than the threshold before them. previous is the threshold before the
+  // first one.
+  //
+  // The block is counted while it is still in L1, so the table check reads
+  // every threshold from memory only once.
+  std::size_t AddThresholds(const std::span<const int> thresholds,
+                            const int previous) {
+    std::uint64_t sum_1 = sum_1_;
+    std::uint64_t sum_2 = sum_2_;
+    for (const int threshold : thresholds) {
+      sum_1 += static_cast<std::uint32_t>(threshold);
+      sum_2 += sum_1;
+    }
+    sum_1_ = sum_1;
+    sum_2_ = sum_2;
+    FinishWords(thresholds.size());
+    if (thresholds.empty()) {
+      return 0;
+    }
+    std::size_t decreases = thresholds[0] < previous ? 1U : 0U;
+    std::size_t i = 1;
+#if defined(__SSE2__)
+    // each lane counts down once per decrease
+    __m128i decreases_x4 = _mm_setzero_si128();
+    for (; i + 4 <= thresholds.size(); i += 4) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      const __m128i current_x4 = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(thresholds.data() + i));
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      const __m128i before_x4 = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(thresholds.data() + i - 1));
+      decreases_x4 = _mm_add_epi32(decreases_x4,
+                                   _mm_cmplt_epi32(current_x4, before_x4));
+    }
+    std::array<std::int32_t, 4> lanes{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.data()), decreases_x4);
+    decreases += static_cast<std::size_t>(-(lanes[0] + lanes[1] + lanes[2] +
+                                            lanes[3]));
+#endif
+    // scalar tail (or the whole count without SIMD support)
+    for (; i < thresholds.size(); ++i) {
+      decreases += thresholds[i] < thresholds[i - 1] ? 1U : 0U;
+    }
+    return decreases;
+  }
+
+  // Adds bytes, read as 32-bit words. bytes.size() must be a multiple of four.
+  void Add(const std::span<const std::byte> bytes) {
+    const std::size_t number_of_words = bytes.size() / sizeof(std::uint32_t);
+    for (std::size_t first = 0; first < number_of_words;
+         first += words_per_block) {
+      const std::size_t last =
+          std::min(first + words_per_block, number_of_words);
+      std::uint64_t sum_1 = sum_1_;
+      std::uint64_t sum_2 = sum_2_;
+      for (std::size_t i = first; i < last; ++i) {
+        std::uint32_t word = 0;
+        std::memcpy(&word, bytes.data() + (i * sizeof(word)), sizeof(word));
+        sum_1 += word;
+        sum_2 += sum_1;
+      }
+      sum_1_ = sum_1;
+      sum_2_ = sum_2;
+      FinishWords(last - first);
+    }
+  }
+
+  // Returns the checksum of every word added so far.
+  [[nodiscard]] std::uint64_t Get() const {
+    return ((sum_2_ % modulus) << 32) | (sum_1_ % modulus);
+  }
+};
+
+// Computes the Fletcher-64 checksum of bytes, read as 32-bit words.
+//
+// bytes.size() must be a multiple of four.
+[[nodiscard]] inline std::uint64_t TableFileChecksum(
+    const std::span<const std::byte> bytes) {
+  TableFileChecksummer checksum;
+  checksum.Add(bytes);
+  return checksum.Get();
+}
+
+// Writes every table in an arena into the table file layout.
+[[nodiscard]] inline std::vector<std::byte> SerializeTableFile(
+    const TableArena& arena) {
+  const std::span<const std::size_t> offsets = arena.GetOffsets();
+  const std::span<const int> thresholds = arena.GetThresholds();
+  TableFileHeader header;
+  header.table_count = arena.GetNumberOfTables();
+  header.threshold_count = thresholds.size();
+  std::vector<std::byte> bytes(sizeof(header) +
+                               (offsets.size() * sizeof(std::uint64_t)) +
+                               thresholds.size_bytes());
+  std::byte* next = bytes.data() + sizeof(header);
+  for (const std::size_t offset : offsets) {
+    const auto wide_offset = static_cast<std::uint64_t>(offset);
+    std::memcpy(next, &wide_offset, sizeof(wide_offset));
+    next += sizeof(wide_offset);
+  }
+  if (!thresholds.empty()) {
+    std::memcpy(next, thresholds.data(), thresholds.size_bytes());
+  }
+  header.checksum =
+      TableFileChecksum(std::span(bytes).subspan(sizeof(header)));
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  return bytes;
+}
+
+// Writes every table in an arena to a table file. Returns false on failure.
+[[nodiscard]] inline bool SaveTableFile(const TableArena& arena,
+                                        const std::filesystem::path& path) {
+  const std::vector<std::byte> bytes = SerializeTableFile(arena);
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): ostream API
+  file.write(reinterpret_cast<const char*>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+  return file.good();
+}
+
+// A non-owning view of the tables in a table file that is already in memory.
+//
+// The tables are served straight from the bytes, so the view never copies or
+// allocates, and it is only valid while the bytes are alive.
+class TableFileView {
+ private:
+  // Where each table starts in thresholds_, followed by the number of
+  // thresholds.
+  const std::uint64_t* offsets_;
+  // The thresholds of every table, back to back.
+  const int* thresholds_;
+  // The number of tables.
+  std::size_t table_count_;
+
+  TableFileView(const std::uint64_t* offsets, const int* thresholds,
+                std::size_t table_count)
+      : offsets_(offsets), thresholds_(thresholds), table_count_(table_count) {}
+
+ public:
+  // Checks a table file and views its tables.
+  //
+  // The bytes must start on an 8-byte boundary, as memory from new or mmap
+  // does. Returns std::nullopt unless the header, the size, the checksum and
+  // every offset are valid, and every table has non-decreasing, non-negative
+  // thresholds with a positive total. The thresholds are checked in the same
+  // pass that computes the checksum, so a file written by another tool cannot
+  // hand MakeTrusted an invalid table.
+  [[nodiscard]] static std::optional<game_dice_cpp::TableFileView> Make(
+      const std::span<const std::byte> bytes) {
+    // validation
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): alignment
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) %
+                alignof(std::uint64_t) !=
+            0 ||
+        bytes.size() < sizeof(TableFileHeader)) {
+      return std::nullopt;
+    }
+    TableFileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != TableFileHeader::expected_magic ||
+        header.version != TableFileHeader::current_version ||
+        header.byte_order != TableFileHeader::expected_byte_order) {
+      return std::nullopt;
+    }
+    // check the size without overflowing on a hostile header
+    const std::size_t body_size = bytes.size() - sizeof(header);
+    if (header.table_count >= body_size / sizeof(std::uint64_t) ||
+        header.threshold_count > body_size / sizeof(int) ||
+        body_size != ((header.table_count + 1) * sizeof(std::uint64_t)) +
+                         (header.threshold_count * sizeof(int))) {
+      return std::nullopt;
+    }
+    const std::span<const std::byte> body = bytes.subspan(sizeof(header));
+    const auto table_count = static_cast<std::size_t>(header.table_count);
+    const std::size_t offsets_size = (table_count + 1) * sizeof(std::uint64_t);
+    // the bytes are aligned and the sizes are checked, so the sections can be
+    // read in place
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): see above
+    const auto* offsets = reinterpret_cast<const std::uint64_t*>(body.data());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): see above
+    const auto* thresholds = reinterpret_cast<const int*>(
+        body.data() + offsets_size);
+    // every table must be non-empty and inside the thresholds
+    if (offsets[0] != 0 || offsets[table_count] != header.threshold_count) {
+      return std::nullopt;
+    }
+    for (std::size_t i = 0; i < table_count; ++i) {
+      if (offsets[i] >= offsets[i + 1]) {
+        return std::nullopt;
+      }
+    }
+    // check the thresholds in the same pass as the checksum. Thresholds may
+    // only decrease where a table starts, so every decrease is counted while
+    // the checksum is summed, and those at table starts are taken back out.
+    TableFileChecksummer checksum;
+    checksum.Add(body.first(offsets_size));
+    const auto threshold_count =
+        static_cast<std::size_t>(header.threshold_count);
+    std::size_t decreases = 0;
+    bool thresholds_valid = true;
+    std::size_t table = 0;
+    for (std::size_t first = 0; first < threshold_count;
+         first += TableFileChecksummer::words_per_block) {
+      const std::size_t last = std::min(
+          first + TableFileChecksummer::words_per_block, threshold_count);
+      decreases += checksum.AddThresholds(
+          std::span<const int>(thresholds + first, last - first),
+          first > 0 ? thresholds[first - 1] : 0);
+      // each table must start at or above zero and end above zero
+      for (; table < table_count && offsets[table] < last; ++table) {
+        const auto start = static_cast<std::size_t>(offsets[table]);
+        thresholds_valid &= thresholds[start] >= 0;
+        if (start > 0) {
+          thresholds_valid &= thresholds[start - 1] > 0;
+          decreases -= thresholds[start] < thresholds[start - 1] ? 1U : 0U;
+        }
+      }
+    }
+    if (threshold_count > 0) {
+      thresholds_valid &= thresholds[threshold_count - 1] > 0;
+    }
+    thresholds_valid &= decreases == 0;
+    if (checksum.Get() != header.checksum || !thresholds_valid) {
+      return std::nullopt;
+    }
+    return TableFileView(offsets, thresholds, table_count);
+  }
+
+  // Returns the number of tables in the file.
+  [[nodiscard]] std::size_t GetNumberOfTables() const { return table_count_; }
+
+  // Returns a view of table index. The index must be in range.
+  [[nodiscard]] DynamicProbabilityTableView GetTable(std::size_t index) const {
+    const auto first = static_cast<std::size_t>(offsets_[index]);
+    const auto last = static_cast<std::size_t>(offsets_[index + 1]);
+    return DynamicProbabilityTableView::MakeTrusted(
+        std::span<const int>(thresholds_ + first, last - first));
+  }
+};
+
+// A table file mapped into memory.
+//
+// The tables are served straight from the mapping, so opening a file costs one
+// pass over it to check the checksum and no allocation per table. On
+// platforms without mmap, the file is read into a single buffer instead.
+class MappedTableFile {
+ private:
+  // The start of the mapped (or read) file.
+  void* address_;
+  // The number of bytes in the file.
+  std::size_t size_;
+  // The tables in the file.
+  TableFileView view_;
+
+  MappedTableFile(void* address, std::size_t size, TableFileView view)
+      : address_(address), size_(size), view_(view) {}
+
+  // Releases the mapping (or buffer) at address.
+  static void Release(void* address, [[maybe_unused]] std::size_t size) {
+#ifdef GAME_DICE_CPP_HAS_MMAP
+    ::munmap(address, size);
+#else
+    delete[] static_cast<std::uint64_t*>(address);
+#endif
+  }
+
+ public:
+  // Maps a table file and checks it. Returns std::nullopt if the file cannot
+  // be read or is not a valid table file.
+  [[nodiscard]] static std::optional<game_dice_cpp::MappedTableFile> Open(
+      const std::filesystem::path& path) {
+    void* address = nullptr;
+    std::size_t size = 0;
+#ifdef GAME_DICE_CPP_HAS_MMAP
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+      return std::nullopt;
+    }
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+      ::close(descriptor);
+      return std::nullopt;
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // the mapping stays valid after the descriptor is closed
+    ::close(descriptor);
+    if (address == MAP_FAILED) {
+      return std::nullopt;
+    }
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file || file.tellg() <= 0) {
+      return std::nullopt;
+    }
+    size = static_cast<std::size_t>(file.tellg());
+    // use 8-byte words so that the buffer is aligned for the offsets
+    auto* buffer = new std::uint64_t[(size + 7) / 8];
+    address = buffer;
+    file.seekg(0);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): istream API
+    if (!file.read(reinterpret_cast<char*>(buffer),
+                   static_cast<std::streamsize>(size))) {
+      Release(address, size);
+      return std::nullopt;
+    }
+#endif
+    const std::optional<TableFileView> view = TableFileView::Make(
+        std::span(static_cast<const std::byte*>(address), size));
+    if (!view.has_value()) {
+      Release(address, size);
+      return std::nullopt;
+    }
+    return MappedTableFile(address, size, *view);
+  }
+
+  MappedTableFile(const MappedTableFile&) = delete;
+  MappedTableFile& operator=(const MappedTableFile&) = delete;
+
+  MappedTableFile(MappedTableFile&& other) noexcept
+      : address_(std::exchange(other.address_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        view_(other.view_) {}
+
+  MappedTableFile& operator=(MappedTableFile&& other) noexcept {
+    if (this != &other) {
+      if (address_ != nullptr) {
+        Release(address_, size_);
+      }
+      address_ = std::exchange(other.address_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      view_ = other.view_;
+    }
+    return *this;
+  }
+
+  ~MappedTableFile() {
+    if (address_ != nullptr) {
+      Release(address_, size_);
+    }
+  }
+
+  // Returns the number of tables in the file.
+  [[nodiscard]] std::size_t GetNumberOfTables() const {
+    return view_.GetNumberOfTables();
+  }
+
+  // Returns a view of table index. The index must be in range.
+  //
+  // The view is valid for as long as this object.
+  [[nodiscard]] DynamicProbabilityTableView GetTable(std::size_t index) const {
+    return view_.GetTable(index);
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_TABLEFILE_H
@@ -0,0 +1,154 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_TWOLEVELPROBABILITYTABLE_H
+#define GAME_DICE_CPP_SRC_TWOLEVELPROBABILITYTABLE_H
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+// A data structure that maps a linear range [1, N] to a set of weight indexes.
+//
+// The cumulative thresholds are cut into blocks of one cache line each. Above
+// them sits a static 16-ary search tree whose nodes are also single cache
+// lines: every node holds the last threshold of each of its 16 children. A
+// lookup counts the thresholds below the roll in one node per level, which
+// picks the child, until it reaches a leaf block.
+//
+// Each level is 16 times smaller than the one below it. With 10 million
+// outcomes the leaves take 40 MB, the level above them 2.5 MB and the next one
+// about 160 KB, which stays in L2. Every level above that fits in 10 KB and
+// stays in L1, so a lookup touches at most two cold cache lines.
+//
+// The name is historical: the first version had a leaf level and one index
+// level above it. The tree now has as many levels as it needs, so its depth
+// grows as log16(n).
+//
+// You should choose TwoLevelProbabilityTable over DynamicProbabilityTable when
+// the table has millions of outcomes.
+class TwoLevelProbabilityTable {
+ public:
+  // The number of thresholds in one block (one 64 byte cache line).
+  static constexpr std::size_t block_size{16};
+
+ private:
+  // One cache line of cumulative thresholds.
+  struct alignas(64) Block {
+    std::array<int, block_size> thresholds;
+  };
+  // The levels of the tree, leaves first. Level 0 holds the cumulative upper
+  // bounds, and every block of level l + 1 holds the last threshold of 16
+  // blocks of level l. Each level is padded with the total weight to whole
+  // blocks, and the last level is a single block.
+  std::vector<std::vector<Block>> levels_;
+  // The number of outcomes in the table.
+  std::size_t number_of_outcomes_;
+
+  explicit TwoLevelProbabilityTable(std::vector<std::vector<Block>>&& levels,
+                                    std::size_t number_of_outcomes)
+      : levels_(std::move(levels)), number_of_outcomes_(number_of_outcomes) {}
+
+  // Counts the thresholds in a block that are below the roll (vectorizes).
+  [[nodiscard]] static std::size_t CountBelow(const Block& block, int roll) {
+    std::size_t count = 0;
+    for (const int threshold : block.thresholds) {
+      count += static_cast<std::size_t>(threshold < roll);
+    }
+    return count;
+  }
+
+  // Packs values into blocks, padding the last block with the final value.
+  [[nodiscard]] static std::vector<Block> MakeLevel(
+      const std::span<const int> values) {
+    std::vector<Block> level((values.size() + block_size - 1) / block_size);
+    for (std::size_t i = 0; i < level.size() * block_size; ++i) {
+      level[i / block_size].thresholds[i % block_size] =
+          values[std::min(i, values.size() - 1)];
+    }
+    return level;
+  }
+
+ public:
+  //
+  [[nodiscard]] static std::optional<game_dice_cpp::TwoLevelProbabilityTable>
+  Make(const std::span<const int> weights) {
+    // validation
+    const std::optional<int> total_weight = SumWeights(weights);
+    if (!total_weight.has_value()) {
+      return std::nullopt;
+    }
+    // calculate thresholds
+    std::vector<int> thresholds(weights.size());
+    int running_total = 0;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      running_total += ClampWeight(weights[i]);
+      thresholds[i] = running_total;
+    }
+    // the leaves hold the thresholds, padded with the total weight so that
+    // they never count past the last outcome
+    std::vector<std::vector<Block>> levels;
+    levels.push_back(MakeLevel(thresholds));
+    // every level above holds the end of every block below it
+    while (levels.back().size() > 1) {
+      thresholds.clear();
+      for (const Block& block : levels.back()) {
+        thresholds.push_back(block.thresholds.back());
+      }
+      levels.push_back(MakeLevel(thresholds));
+    }
+    return TwoLevelProbabilityTable(std::move(levels), weights.size());
+  }
+  // Returns the exact die size required to drive this table.
+  [[nodiscard]] int GetTotalWeight() const {
+    return levels_.back().front().thresholds.back();
+  }
+
+  // Maps a value (example: from a die roll) to an outcome index.
+  [[nodiscard]] int GetOutcomeIndex(int roll) const {
+    // descend from the root, one cache line per level
+    std::size_t block = 0;
+    for (std::size_t level = levels_.size() - 1; level > 0; --level) {
+      const std::size_t child =
+          (block * block_size) + CountBelow(levels_[level][block], roll);
+      // rolls past the total weight clamp to the last child
+      block = std::min(child, levels_[level - 1].size() - 1);
+    }
+    // count the thresholds below the roll in the leaf
+    const std::size_t count = CountBelow(levels_.front()[block], roll);
+    // clamp value within range of table
+    return static_cast<int>(
+        std::min((block * block_size) + count, number_of_outcomes_ - 1));
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_TWOLEVELPROBABILITYTABLE_H
@@ -0,0 +1,83 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_WEIGHTVALIDATION_H
+#define GAME_DICE_CPP_SRC_WEIGHTVALIDATION_H
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <ranges>
+
+#include "./IntegerConcepts.h"
+
+namespace game_dice_cpp {
+
+// Clamps a single weight so that it is never negative.
+//
+// This is a function object so that it can be passed to algorithms for any
+// weight type.
+inline constexpr auto ClampWeight = []<CountingInteger Weight>(Weight weight) {
+  return std::max(weight, Weight{0});
+};
+
+// Sums a set of weights with check-as-you-go overflow detection.
+//
+// Negative weights are treated as zero. This is the validation shared by every
+// probability table in the library.
+//
+// Returns std::nullopt if the sum overflows the weight type or is not positive.
+template <std::ranges::input_range Weights>
+  requires CountingInteger<std::ranges::range_value_t<Weights>>
+[[nodiscard]] constexpr std::optional<std::ranges::range_value_t<Weights>>
+SumWeights(const Weights& weights) {
+  using Weight = std::ranges::range_value_t<Weights>;
+  // create a view that sees only non-negative weights
+  auto safe_weights = weights | std::ranges::views::transform(ClampWeight);
+  // use std::optional<Weight> to carry the valid state through the loop
+  std::optional<Weight> total_weight = std::accumulate(
+      safe_weights.begin(), safe_weights.end(), std::optional<Weight>(0),
+      [](std::optional<Weight> accumulated,
+         Weight weight) -> std::optional<Weight> {
+        // if a previous step failed...
+        if (!accumulated) {
+          return std::nullopt;
+        }
+        // check for overflow before it happens
+        if (weight > std::numeric_limits<Weight>::max() - *accumulated) {
+          return std::nullopt;
+        }
+        return *accumulated + weight;
+      });
+  // validation
+  if (!total_weight.has_value() || *total_weight <= 0) {
+    return std::nullopt;
+  }
+  return total_weight;
+}
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_WEIGHTVALIDATION_H
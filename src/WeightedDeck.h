@@ -0,0 +1,125 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_WEIGHTEDDECK_H
+#define GAME_DICE_CPP_SRC_WEIGHTEDDECK_H
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./FenwickTree.h"
+#include "./WeightValidation.h"
+
+namespace game_dice_cpp {
+// A deck of weighted cards that are drawn without replacement.
+//
+// Every draw picks a remaining card with probability proportional to its
+// weight and removes it from the deck. The weights live in a Fenwick tree, so a
+// draw costs O(log n) and never allocates. Reset() puts the drawn cards back in
+// O(log n) per drawn card.
+//
+// You should choose WeightedDeck over rebuilding a DynamicProbabilityTable
+// after every draw, which makes drawing the whole deck O(n^2).
+class WeightedDeck {
+ private:
+  // The (non-negative) weight of every card.
+  std::vector<int> weights_;
+  // The Fenwick tree over the weights of the cards still in the deck.
+  FenwickTree tree_;
+  // The cards drawn since the last Reset(), in draw order.
+  std::vector<int> drawn_;
+  // The sum of the weights of the cards still in the deck.
+  int remaining_weight_;
+
+  explicit WeightedDeck(std::vector<int>&& weights, int total_weight)
+      : weights_(std::move(weights)),
+        tree_(weights_),
+        remaining_weight_(total_weight) {
+    // reserve once so that drawing never allocates
+    drawn_.reserve(weights_.size());
+  }
+
+ public:
+  //
+  [[nodiscard]] static std::optional<game_dice_cpp::WeightedDeck> Make(
+      const std::span<const int> weights) {
+    // validation
+    const std::optional<int> total_weight = SumWeights(weights);
+    if (!total_weight.has_value()) {
+      return std::nullopt;
+    }
+    std::vector<int> safe_weights(weights.size());
+    std::ranges::transform(weights, safe_weights.begin(), ClampWeight);
+    return WeightedDeck(std::move(safe_weights), *total_weight);
+  }
+
+  // Returns the sum of the weights of the cards still in the deck.
+  [[nodiscard]] int GetRemainingWeight() const { return remaining_weight_; }
+
+  // Returns true when no card with a positive weight is left to draw.
+  [[nodiscard]] bool IsEmpty() const { return remaining_weight_ == 0; }
+
+  // Returns the cards drawn since the last Reset(), in draw order.
+  [[nodiscard]] std::span<const int> GetDrawnCards() const { return drawn_; }
+
+  // Draws a card, removes it from the deck, and returns its index.
+  //
+  // Cards with zero weight are never drawn.
+  //
+  // Returns std::nullopt when the deck is empty.
+  //
+  // engine: A C++ STL compatible random number engine
+  template <typename Engine>
+  [[nodiscard]] std::optional<int> Draw(Engine& engine) {
+    if (IsEmpty()) {
+      return std::nullopt;
+    }
+    // NOLINTNEXTLINE(misc-const-correctness): STL dists not const-callable
+    std::uniform_int_distribution<int> distribution(1, remaining_weight_);
+    const std::size_t card = tree_.Find(distribution(engine));
+    // take the card out of the deck
+    tree_.Add(card, -weights_[card]);
+    remaining_weight_ -= weights_[card];
+    drawn_.push_back(static_cast<int>(card));
+    return static_cast<int>(card);
+  }
+
+  // Puts every drawn card back into the deck.
+  void Reset() {
+    for (const int card : drawn_) {
+      const auto index = static_cast<std::size_t>(card);
+      tree_.Add(index, weights_[index]);
+      remaining_weight_ += weights_[index];
+    }
+    drawn_.clear();
+  }
+};
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_WEIGHTEDDECK_H
@@ -0,0 +1,243 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_WEIGHTEDRESERVOIR_H
+#define GAME_DICE_CPP_SRC_WEIGHTEDRESERVOIR_H
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./IntegerConcepts.h"
+
+namespace game_dice_cpp {
+// Selects up to k distinct candidates by weight from a stream in one pass.
+//
+// This is the weighted reservoir sampler of Efraimidis and Spirakis with
+// exponential jumps (A-ExpJ). Every candidate gets the key u^(1/weight) and the
+// k largest keys win, which is the same as drawing k times by weight without
+// replacement. Keys are kept as logarithms so that tiny keys do not underflow.
+// Once the reservoir is full, the sampler skips ahead by weight and only draws
+// random numbers for the O(k log(n / k)) candidates that enter it.
+//
+// Candidates with a weight of zero or less are never selected.
+template <typename Id = int>
+class WeightedReservoir {
+ private:
+  // One selected candidate.
+  struct Entry {
+    // The logarithm of the candidate's key.
+    double log_key;
+    Id id;
+  };
+  // A min-heap on log_key, so the weakest entry is at the front.
+  std::vector<Entry> entries_;
+  // The largest number of candidates to select.
+  std::size_t capacity_;
+  // The weight still to be skipped before the next candidate enters. Weights
+  // are integers, so the real-valued jump is rounded up without changing which
+  // candidate it lands on.
+  std::uint64_t skip_weight_;
+  // A jump past the end of any stream.
+  static constexpr std::uint64_t max_skip_weight{
+      std::numeric_limits<std::uint64_t>::max()};
+
+  [[nodiscard]] static bool StrongerKey(const Entry& lhs, const Entry& rhs) {
+    return lhs.log_key > rhs.log_key;
+  }
+
+  // Returns a uniform value in (0, 1], so that its logarithm is finite.
+  template <typename Engine>
+  [[nodiscard]] static double Uniform(Engine& engine) {
+    return 1.0 - std::generate_canonical<double,
+                                         std::numeric_limits<double>::digits>(
+                     engine);
+  }
+
+  // Draws the weight to skip before the next candidate enters.
+  template <typename Engine>
+  void DrawSkip(Engine& engine) {
+    const double log_threshold = entries_.front().log_key;
+    // a key of exactly one can never be beaten
+    const double skip = log_threshold < 0.0
+                            ? std::ceil(std::log(Uniform(engine)) / log_threshold)
+                            : std::numeric_limits<double>::infinity();
+    // every jump that does not fit is past the end of any real stream
+    skip_weight_ = skip < static_cast<double>(max_skip_weight)
+                       ? static_cast<std::uint64_t>(skip)
+                       : max_skip_weight;
+  }
+
+  // Puts a candidate into the full reservoir in place of the weakest entry.
+  template <typename Engine>
+  void Replace(const Id& id, double weight, Engine& engine) {
+    // the new key is uniform between the weakest key and one
+    const double log_threshold = entries_.front().log_key;
+    const double threshold = std::exp(weight * log_threshold);
+    const double key = threshold + ((1.0 - threshold) * Uniform(engine));
+    std::ranges::pop_heap(entries_, StrongerKey);
+    entries_.back() = Entry{
+        .log_key = std::max(std::log(key) / weight, log_threshold), .id = id};
+    std::ranges::push_heap(entries_, StrongerKey);
+    DrawSkip(engine);
+  }
+
+ public:
+  // Creates an empty reservoir that selects up to k candidates.
+  explicit WeightedReservoir(std::size_t k)
+      : capacity_(k),
+        // an empty reservoir skips every candidate
+        skip_weight_(k == 0 ? max_skip_weight : 0) {
+    entries_.reserve(k);
+  }
+
+  // Offers a single candidate from the stream.
+  //
+  // engine: A C++ STL compatible random number engine
+  template <CountingInteger Weight, typename Engine>
+  void Offer(const Id& id, Weight weight, Engine& engine) {
+    if (weight <= 0) {
+      return;
+    }
+    // fill the reservoir before skipping
+    if (entries_.size() < capacity_) {
+      entries_.push_back(Entry{
+          .log_key = std::log(Uniform(engine)) / static_cast<double>(weight),
+          .id = id});
+      std::ranges::push_heap(entries_, StrongerKey);
+      if (entries_.size() == capacity_) {
+        DrawSkip(engine);
+      }
+      return;
+    }
+    // jump over candidates until the skipped weight is used up
+    const auto unsigned_weight = static_cast<std::uint64_t>(weight);
+    if (unsigned_weight < skip_weight_) [[likely]] {
+      skip_weight_ -= unsigned_weight;
+      return;
+    }
+    Replace(id, static_cast<double>(weight), engine);
+  }
+
+  // Returns the number of candidates selected so far.
+  [[nodiscard]] std::size_t GetSize() const { return entries_.size(); }
+
+  // Returns the selected candidates in the order they would have been drawn.
+  [[nodiscard]] std::vector<Id> GetSample() const {
+    std::vector<Entry> sorted = entries_;
+    std::ranges::sort(sorted, StrongerKey);
+    std::vector<Id> sample;
+    sample.reserve(sorted.size());
+    for (const Entry& entry : sorted) {
+      sample.push_back(entry.id);
+    }
+    return sample;
+  }
+};
+
+// Selects up to k distinct ids by weight from a range of (id, weight) pairs in
+// one pass.
+//
+// The range is read once, so it can be a stream that is never stored.
+//
+// engine: A C++ STL compatible random number engine
+template <std::ranges::input_range Candidates, typename Engine>
+[[nodiscard]] auto SampleWeightedReservoir(Candidates&& candidates,
+                                           std::size_t k, Engine& engine) {
+  using Id = std::remove_cvref_t<
+      std::tuple_element_t<0, std::ranges::range_value_t<Candidates>>>;
+  WeightedReservoir<Id> reservoir(k);
+  for (auto&& candidate : candidates) {
+    const auto& [id, weight] = candidate;
+    reservoir.Offer(id, weight, engine);
+  }
+  return reservoir.GetSample();
+}
+
+// Selects up to k distinct outcome indexes by weight from cumulative
+// thresholds.
+//
+// Small samples first draw with lookup and reject repeats, which costs
+// O(k log n) when no outcome dominates. If repeats use up the attempt budget,
+// the remaining picks come from a reservoir over the unpicked outcomes, which
+// continues the same draw-without-replacement process exactly.
+//
+// lookup: maps a roll in [1, total weight] to an outcome index
+// engine: A C++ STL compatible random number engine
+template <typename Weight, typename Lookup, typename Engine>
+[[nodiscard]] std::vector<int> SampleDistinctOutcomes(
+    const std::span<const Weight> thresholds, const Lookup& lookup,
+    std::size_t k, Engine& engine) {
+  // rejection is only worth it while the repeat check is cheap
+  constexpr std::size_t rejection_max_sample{64};
+  constexpr std::size_t attempts_per_pick{4};
+  std::vector<int> sample;
+  sample.reserve(std::min(k, thresholds.size()));
+  if (k <= rejection_max_sample) {
+    // NOLINTNEXTLINE(misc-const-correctness): STL dists not const-callable
+    std::uniform_int_distribution<Weight> distribution(1, thresholds.back());
+    for (std::size_t attempt = 0;
+         attempt < attempts_per_pick * k && sample.size() < k; ++attempt) {
+      const int outcome = lookup(distribution(engine));
+      if (std::ranges::find(sample, outcome) == sample.end()) {
+        sample.push_back(outcome);
+      }
+    }
+    if (sample.size() == k) {
+      return sample;
+    }
+  }
+  // finish with a reservoir over the outcomes that are not picked yet,
+  // walking the sorted picks alongside the outcomes so the pass stays O(n)
+  std::vector<int> picked = sample;
+  std::ranges::sort(picked);
+  auto next_picked = picked.begin();
+  WeightedReservoir<int> reservoir(k - sample.size());
+  Weight previous_threshold = 0;
+  for (std::size_t i = 0; i < thresholds.size(); ++i) {
+    const auto outcome = static_cast<int>(i);
+    if (next_picked != picked.end() && *next_picked == outcome) {
+      ++next_picked;
+    } else {
+      reservoir.Offer(outcome, thresholds[i] - previous_threshold, engine);
+    }
+    previous_threshold = thresholds[i];
+  }
+  std::ranges::copy(reservoir.GetSample(), std::back_inserter(sample));
+  return sample;
+}
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_WEIGHTEDRESERVOIR_H
@@ -0,0 +1,83 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_WYRAND_H
+#define GAME_DICE_CPP_SRC_WYRAND_H
+#include <cstdint>
+#include <limits>
+
+#include "./BoundedRandom.h"
+
+namespace game_dice_cpp {
+
+// A 64-bit random number engine with a single word of state.
+//
+// wyrand adds a fixed constant to its state and folds the 128-bit product of
+// the state with a scrambled copy of itself. It needs one multiplication per
+// value and has the smallest state of the engines here, which suits a stream
+// per game entity.
+//
+// This satisfies std::uniform_random_bit_generator and works with Roll.
+class WyRand {
+ private:
+  // The position in the stream.
+  std::uint64_t state_;
+
+ public:
+  using result_type = std::uint64_t;
+  static constexpr result_type default_seed{0};
+
+  // Constructs the engine with the default seed.
+  constexpr WyRand() : WyRand(default_seed) {}
+  // Constructs the engine from a seed. Every seed is valid.
+  constexpr explicit WyRand(const result_type seed) : state_(seed) {}
+
+  // Restarts the stream from a seed.
+  constexpr void seed(const result_type seed = default_seed) { state_ = seed; }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Advances the engine and returns the next value.
+  constexpr result_type operator()() {
+    state_ += 0xa076'1d64'78bd'642fU;
+    const WideProduct<std::uint64_t> product =
+        MultiplyWide(state_, state_ ^ 0xe703'7ed1'a0b4'28dbU);
+    return product.high ^ product.low;
+  }
+
+  // Advances the engine by count values in constant time.
+  constexpr void discard(const unsigned long long count) {
+    state_ += 0xa076'1d64'78bd'642fU * count;
+  }
+
+  friend constexpr bool operator==(const WyRand&, const WyRand&) = default;
+};
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_WYRAND_H
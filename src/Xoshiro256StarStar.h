@@ -0,0 +1,116 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef GAME_DICE_CPP_SRC_XOSHIRO256STARSTAR_H
+#define GAME_DICE_CPP_SRC_XOSHIRO256STARSTAR_H
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+#include "./SplitMix64.h"
+
+namespace game_dice_cpp {
+
+// A 64-bit random number engine with four words of state.
+//
+// xoshiro256** updates its state with shifts, rotations and exclusive ors, and
+// scrambles one word with two multiplications. Its period is 2^256 - 1, which
+// makes it the general purpose choice when mt19937 is too large and too slow.
+//
+// A single seed is expanded into the state with SplitMix64, as the authors
+// recommend, so similar seeds still give unrelated streams.
+//
+// This satisfies std::uniform_random_bit_generator and works with Roll.
+class Xoshiro256StarStar {
+ public:
+  using result_type = std::uint64_t;
+  using State = std::array<std::uint64_t, 4>;
+  static constexpr result_type default_seed{0};
+
+ private:
+  // The four words of state, never all zero.
+  State state_;
+
+  // Expands a single seed into a full state.
+  [[nodiscard]] static constexpr State ExpandSeed(const result_type seed) {
+    SplitMix64 expander(seed);
+    return State{expander(), expander(), expander(), expander()};
+  }
+
+ public:
+  // Constructs the engine with the default seed.
+  constexpr Xoshiro256StarStar() : Xoshiro256StarStar(default_seed) {}
+  // Constructs the engine from a seed. Every seed is valid.
+  constexpr explicit Xoshiro256StarStar(const result_type seed)
+      : state_(ExpandSeed(seed)) {}
+  // Constructs the engine from a full state.
+  //
+  // The all-zero state only ever produces zeros, so it is replaced by the
+  // state for the default seed.
+  constexpr explicit Xoshiro256StarStar(const State& state)
+      : state_(state == State{} ? ExpandSeed(default_seed) : state) {}
+
+  // Restarts the stream from a seed.
+  constexpr void seed(const result_type seed = default_seed) {
+    state_ = ExpandSeed(seed);
+  }
+  // Retrieves the full state, for saving or replaying the stream.
+  [[nodiscard]] constexpr const State& GetState() const noexcept {
+    return state_;
+  }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Advances the engine and returns the next value.
+  constexpr result_type operator()() {
+    const result_type result = std::rotl(state_[1] * 5, 7) * 9;
+    const std::uint64_t shifted = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= shifted;
+    state_[3] = std::rotl(state_[3], 45);
+    return result;
+  }
+
+  // Advances the engine by count values.
+  constexpr void discard(unsigned long long count) {
+    for (; count > 0; --count) {
+      static_cast<void>((*this)());
+    }
+  }
+
+  friend constexpr bool operator==(const Xoshiro256StarStar&,
+                                   const Xoshiro256StarStar&) = default;
+};
+
+}  // namespace game_dice_cpp
+
+#endif  // GAME_DICE_CPP_SRC_XOSHIRO256STARSTAR_H
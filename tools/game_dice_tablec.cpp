@@ -0,0 +1,332 @@
+//
+// Copyright 2026 scholar-of-artifice
+//
+// Licensed under the MIT License
+//
+// Copyright (c) 2026 scholar-of-artifice
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// game_dice_tablec: compiles designer-authored weights into probability tables
+// at build time.
+//
+// The input is a CSV file with one table per line, a name followed by its
+// weights. Blank lines and lines starting with '#' are ignored. Every name
+// must be a C++ identifier that is not a keyword, and no name may repeat or
+// equal another table's <name>_index. Example:
+//   # name, weights...
+//   loot_common, 60, 30, 10
+//   loot_boss, 5, 15, 80
+//
+// Usage:
+//   game_dice_tablec [--header <file>] [--blob <file>] [--namespace <name>]
+//                    <weights.csv>
+//
+// --header writes a header of constexpr StaticProbabilityTable objects, plus
+// the index of every table in the blob. --blob writes a table file that
+// MappedTableFile can map at startup.
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "TableArena.h"
+#include "TableFile.h"
+#include "WeightValidation.h"
+
+namespace {
+// One table read from the input.
+struct NamedWeights {
+  std::string name;
+  std::vector<int> weights;
+  // Where the table was read, for diagnostics.
+  std::string location;
+};
+
+// The C++ keywords and alternative tokens, which cannot name a table or a
+// namespace.
+constexpr auto cpp_keywords = std::to_array<std::string_view>(
+    {"alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor",
+     "bool", "break", "case", "catch", "char", "char8_t", "char16_t",
+     "char32_t", "class", "co_await", "co_return", "co_yield", "compl",
+     "concept", "const", "const_cast", "consteval", "constexpr", "constinit",
+     "continue", "decltype", "default", "delete", "do", "double",
+     "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false",
+     "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable",
+     "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator",
+     "or", "or_eq", "private", "protected", "public", "register",
+     "reinterpret_cast", "requires", "return", "short", "signed", "sizeof",
+     "static", "static_assert", "static_cast", "struct", "switch", "template",
+     "this", "thread_local", "throw", "true", "try", "typedef", "typeid",
+     "typename", "union", "unsigned", "using", "virtual", "void", "volatile",
+     "wchar_t", "while", "xor", "xor_eq"});
+
+// Returns field without leading or trailing whitespace.
+std::string_view Trim(std::string_view field) {
+  while (!field.empty() &&
+         std::isspace(static_cast<unsigned char>(field.front())) != 0) {
+    field.remove_prefix(1);
+  }
+  while (!field.empty() &&
+         std::isspace(static_cast<unsigned char>(field.back())) != 0) {
+    field.remove_suffix(1);
+  }
+  return field;
+}
+
+// Returns true if name can be used as a C++ identifier: it is not a keyword
+// and not reserved for the implementation.
+bool IsIdentifier(std::string_view name) {
+  if (name.empty() ||
+      std::isdigit(static_cast<unsigned char>(name.front())) != 0) {
+    return false;
+  }
+  for (const char character : name) {
+    if (std::isalnum(static_cast<unsigned char>(character)) == 0 &&
+        character != '_') {
+      return false;
+    }
+  }
+  const bool reserved =
+      name.contains("__") ||
+      (name.size() > 1 && name[0] == '_' &&
+       std::isupper(static_cast<unsigned char>(name[1])) != 0);
+  return !reserved &&
+         std::ranges::find(cpp_keywords, name) == cpp_keywords.end();
+}
+
+// Returns true if name can be used as a namespace, including nested
+// namespaces such as "game::tables".
+bool IsNamespace(std::string_view name) {
+  while (true) {
+    const std::size_t separator = name.find("::");
+    if (!IsIdentifier(name.substr(0, separator))) {
+      return false;
+    }
+    if (separator == std::string_view::npos) {
+      return true;
+    }
+    name.remove_prefix(separator + 2);
+  }
+}
+
+// Checks that every generated name is unique, reporting the first clash to
+// std::cerr. Each table emits both <name> and <name>_index.
+bool CheckNamesAreUnique(const std::vector<NamedWeights>& tables) {
+  // map every generated name to the table that emits it
+  std::unordered_map<std::string, const NamedWeights*> owners;
+  for (const NamedWeights& table : tables) {
+    for (const std::string& name : {table.name, table.name + "_index"}) {
+      const auto [owner, inserted] = owners.try_emplace(name, &table);
+      if (!inserted) {
+        std::cerr << table.location << ": '" << name
+                  << "' is already defined by table '" << owner->second->name
+                  << "' at " << owner->second->location << "\n";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Writes weight as a C++ expression of type int.
+//
+// The literal 2147483648 does not fit in an int, so -2147483648 is written as
+// a subtraction.
+void WriteWeight(std::ostream& text, int weight) {
+  if (weight == std::numeric_limits<int>::min()) {
+    text << "(" << weight + 1 << " - 1)";
+  } else {
+    text << weight;
+  }
+}
+
+// Reads every table from a CSV file, reporting the first error to std::cerr.
+std::optional<std::vector<NamedWeights>> ReadWeightsFile(
+    const std::filesystem::path& path) {
+  std::ifstream file(path);
+  if (!file) {
+    std::cerr << path.string() << ": cannot open file\n";
+    return std::nullopt;
+  }
+  std::vector<NamedWeights> tables;
+  std::string line;
+  int line_number = 0;
+  while (std::getline(file, line)) {
+    ++line_number;
+    const std::string_view trimmed = Trim(line);
+    if (trimmed.empty() || trimmed.front() == '#') {
+      continue;
+    }
+    // split the line on commas
+    std::vector<std::string_view> fields;
+    std::size_t start = 0;
+    while (true) {
+      const std::size_t comma = trimmed.find(',', start);
+      fields.push_back(Trim(trimmed.substr(start, comma - start)));
+      if (comma == std::string_view::npos) {
+        break;
+      }
+      start = comma + 1;
+    }
+    const std::string location =
+        path.string() + ":" + std::to_string(line_number);
+    NamedWeights table{.name = std::string(fields.front()),
+                       .weights = {},
+                       .location = location};
+    if (!IsIdentifier(table.name)) {
+      std::cerr << location << ": '" << table.name
+                << "' is not a valid table name\n";
+      return std::nullopt;
+    }
+    for (std::size_t i = 1; i < fields.size(); ++i) {
+      int weight = 0;
+      const auto [end, error] = std::from_chars(
+          fields[i].data(), fields[i].data() + fields[i].size(), weight);
+      if (error != std::errc{} || end != fields[i].data() + fields[i].size()) {
+        std::cerr << location << ": '" << fields[i] << "' is not a weight\n";
+        return std::nullopt;
+      }
+      table.weights.push_back(weight);
+    }
+    // validation, so that the generated code cannot fail to compile
+    if (!game_dice_cpp::SumWeights(table.weights).has_value()) {
+      std::cerr << location << ": table '" << table.name
+                << "' has no positive weight or overflows an int\n";
+      return std::nullopt;
+    }
+    tables.push_back(std::move(table));
+  }
+  if (!CheckNamesAreUnique(tables)) {
+    return std::nullopt;
+  }
+  return tables;
+}
+
+// Writes a header of constexpr tables and blob indexes.
+bool WriteHeader(const std::vector<NamedWeights>& tables,
+                 const std::filesystem::path& input,
+                 const std::filesystem::path& output,
+                 const std::string& name_space) {
+  // derive the include guard from the output file name
+  std::string guard = "GAME_DICE_CPP_GENERATED_";
+  for (const char character : output.filename().string()) {
+    guard += std::isalnum(static_cast<unsigned char>(character)) != 0
+                 ? static_cast<char>(
+                       std::toupper(static_cast<unsigned char>(character)))
+                 : '_';
+  }
+  std::ostringstream text;
+  text << "// Generated by game_dice_tablec from " << input.filename().string()
+       << ". Do not edit.\n\n"
+       << "#ifndef " << guard << "\n#define " << guard << "\n"
+       << "#include <cstddef>\n\n"
+       << "#include \"StaticProbabilityTable.h\"\n\n"
+       << "namespace " << name_space << " {\n";
+  for (const NamedWeights& table : tables) {
+    text << "inline constexpr auto " << table.name
+         << " =\n    *::game_dice_cpp::StaticProbabilityTable<"
+         << table.weights.size() << ">::Make({";
+    for (std::size_t i = 0; i < table.weights.size(); ++i) {
+      text << (i == 0 ? "" : ", ");
+      WriteWeight(text, table.weights[i]);
+    }
+    text << "});\n";
+  }
+  text << "\n// The index of every table in the matching table file.\n";
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    text << "inline constexpr ::std::size_t " << tables[i].name << "_index{"
+         << i << "};\n";
+  }
+  text << "}  // namespace " << name_space << "\n\n#endif  // " << guard
+       << "\n";
+  std::ofstream file(output, std::ios::trunc);
+  file << text.str();
+  return file.good();
+}
+
+// Writes a table file of precomputed thresholds.
+bool WriteBlob(const std::vector<NamedWeights>& tables,
+               const std::filesystem::path& output) {
+  std::vector<std::vector<int>> weights;
+  weights.reserve(tables.size());
+  for (const NamedWeights& table : tables) {
+    weights.push_back(table.weights);
+  }
+  // every table was validated when it was read
+  const auto arena = game_dice_cpp::TableArena::Make(weights);
+  return arena.has_value() && game_dice_cpp::SaveTableFile(*arena, output);
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::vector<std::string_view> arguments(argv + 1, argv + argc);
+  std::optional<std::filesystem::path> input;
+  std::optional<std::filesystem::path> header;
+  std::optional<std::filesystem::path> blob;
+  std::string name_space = "game_tables";
+  for (std::size_t i = 0; i < arguments.size(); ++i) {
+    const bool has_value = i + 1 < arguments.size();
+    if (arguments[i] == "--header" && has_value) {
+      header = arguments[++i];
+    } else if (arguments[i] == "--blob" && has_value) {
+      blob = arguments[++i];
+    } else if (arguments[i] == "--namespace" && has_value) {
+      name_space = arguments[++i];
+    } else if (!input.has_value() && !arguments[i].starts_with("--")) {
+      input = arguments[i];
+    } else {
+      input.reset();
+      break;
+    }
+  }
+  if (!input.has_value() || (!header.has_value() && !blob.has_value())) {
+    std::cerr << "usage: game_dice_tablec [--header <file>] [--blob <file>] "
+                 "[--namespace <name>] <weights.csv>\n";
+    return 2;
+  }
+  if (!IsNamespace(name_space)) {
+    std::cerr << "'" << name_space << "' is not a valid namespace\n";
+    return 2;
+  }
+  const auto tables = ReadWeightsFile(*input);
+  if (!tables.has_value()) {
+    return 1;
+  }
+  if (header.has_value() && !WriteHeader(*tables, *input, *header, name_space)) {
+    std::cerr << header->string() << ": cannot write file\n";
+    return 1;
+  }
+  if (blob.has_value() && !WriteBlob(*tables, *blob)) {
+    std::cerr << blob->string() << ": cannot write file\n";
+    return 1;
+  }
+  return 0;
+}